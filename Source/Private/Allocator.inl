@@ -2,77 +2,89 @@
 #define ALLOCATOR_INL_HPP
 
 #include <forge-memory/Allocator.hpp>
+#include <forge-memory/CycleCounter.hpp>
 #include <forge-memory/MemoryUtilities.hpp>
 
 namespace Forge
 {
-	template<typename AllocationPolicy>
-	FORGE_FORCE_INLINE Size Allocator<AllocationPolicy>::GetCapacity()
+	template<typename AllocationPolicy, typename AllocationStats>
+	FORGE_FORCE_INLINE Size Allocator<AllocationPolicy, AllocationStats>::GetCapacity()
 	{
 		return m_capacity;
 	}
-	template<typename AllocationPolicy>
-	FORGE_FORCE_INLINE Float32 Allocator<AllocationPolicy>::GetUsedSpace()
+	template<typename AllocationPolicy, typename AllocationStats>
+	FORGE_FORCE_INLINE Float32 Allocator<AllocationPolicy, AllocationStats>::GetUsedSpace()
 	{
-		return m_used_space;
+		if (!m_capacity) {
+			return 0.0f;
+		}
+
+		return static_cast<Float32>(m_allocation_stats.GetTotalSize()) / static_cast<Float32>(m_capacity) * 100.0f;
+	}
+	template<typename AllocationPolicy, typename AllocationStats>
+	FORGE_FORCE_INLINE AllocationPolicy& Allocator<AllocationPolicy, AllocationStats>::GetAllocationPolicy()
+	{
+		return m_allocation_policy;
+	}
+	template<typename AllocationPolicy, typename AllocationStats>
+	FORGE_FORCE_INLINE AllocationStats& Allocator<AllocationPolicy, AllocationStats>::GetAllocationStats()
+	{
+		return m_allocation_stats;
+	}
+	template<typename AllocationPolicy, typename AllocationStats>
+	FORGE_FORCE_INLINE Bool Allocator<AllocationPolicy, AllocationStats>::IsHugePageBacked()
+	{
+		return m_allocation_policy.IsHugePageBacked();
 	}
 
-	template<typename AllocationPolicy>
-	FORGE_FORCE_INLINE Size Allocator<AllocationPolicy>::GetPeakSize()
+	template<typename AllocationPolicy, typename AllocationStats>
+	FORGE_FORCE_INLINE Size Allocator<AllocationPolicy, AllocationStats>::GetPeakSize()
 	{
-		return m_allocation_stats.m_peak_size;
+		return m_allocation_stats.GetPeakSize();
 	}
-	template<typename AllocationPolicy>
-	FORGE_FORCE_INLINE Size Allocator<AllocationPolicy>::GetTotalSize()
+	template<typename AllocationPolicy, typename AllocationStats>
+	FORGE_FORCE_INLINE Size Allocator<AllocationPolicy, AllocationStats>::GetTotalSize()
 	{
-		return m_allocation_stats.m_total_size;
+		return m_allocation_stats.GetTotalSize();
 	}
-	template<typename AllocationPolicy>
-	FORGE_FORCE_INLINE Size Allocator<AllocationPolicy>::GetNumOfAllocations()
+	template<typename AllocationPolicy, typename AllocationStats>
+	FORGE_FORCE_INLINE Size Allocator<AllocationPolicy, AllocationStats>::GetNumOfAllocations()
 	{
-		return m_allocation_stats.m_num_of_allocs;
+		return m_allocation_stats.GetNumOfAllocations();
 	}
-	template<typename AllocationPolicy>
-	FORGE_FORCE_INLINE Size Allocator<AllocationPolicy>::GetNumOfDeallocations()
+	template<typename AllocationPolicy, typename AllocationStats>
+	FORGE_FORCE_INLINE Size Allocator<AllocationPolicy, AllocationStats>::GetNumOfDeallocations()
 	{
-		return m_allocation_stats.m_num_of_deallocs;
+		return m_allocation_stats.GetNumOfDeallocations();
 	}
 
-	template<typename AllocationPolicy>
-	FORGE_FORCE_INLINE Size Allocator<AllocationPolicy>::GetAllocatedSize(VoidPtr address)
+	template<typename AllocationPolicy, typename AllocationStats>
+	FORGE_FORCE_INLINE Size Allocator<AllocationPolicy, AllocationStats>::GetAllocatedSize(VoidPtr address)
 	{
-		return 0;
+		return m_allocation_policy.GetAllocatedSize(address);
 	}
 
-	template<typename AllocationPolicy>
-	FORGE_FORCE_INLINE Void Allocator<AllocationPolicy>::Initialize(Size capacity)
+	template<typename AllocationPolicy, typename AllocationStats>
+	FORGE_FORCE_INLINE Void Allocator<AllocationPolicy, AllocationStats>::Initialize(Size capacity)
 	{
 		m_capacity = capacity;
-		m_used_space = 0.0f;
 
-		m_allocation_stats.m_peak_size = 0;
-		m_allocation_stats.m_total_size = 0;
-		m_allocation_stats.m_num_of_allocations = 0;
-		m_allocation_stats.m_num_of_deallocations = 0;
+		m_allocation_stats.Reset();
 
 		m_allocation_policy.Initialize(capacity);
 	}
-	template<typename AllocationPolicy>
-	FORGE_FORCE_INLINE Void Allocator<AllocationPolicy>::Deinitialize()
+	template<typename AllocationPolicy, typename AllocationStats>
+	FORGE_FORCE_INLINE Void Allocator<AllocationPolicy, AllocationStats>::Deinitialize()
 	{
 		m_capacity = 0;
-		m_used_space = 0.0f;
 
-		m_allocation_stats.m_peak_size = 0;
-		m_allocation_stats.m_total_size = 0;
-		m_allocation_stats.m_num_of_allocations = 0;
-		m_allocation_stats.m_num_of_deallocations = 0;
+		m_allocation_stats.Reset();
 
 		m_allocation_policy.Deinitialize();
 	}
 
-	template<typename AllocationPolicy>
-	FORGE_FORCE_INLINE VoidPtr Allocator<AllocationPolicy>::Allocate(Size size, Size alignment)
+	template<typename AllocationPolicy, typename AllocationStats>
+	FORGE_FORCE_INLINE VoidPtr Allocator<AllocationPolicy, AllocationStats>::Allocate(Size size, Size alignment)
 	{
 		if (size == 0) {
 			return nullptr;
@@ -82,21 +94,30 @@ namespace Forge
 			return nullptr;
 		}
 
+		Size start_cycles = 0;
+
+		if constexpr (AllocationStats::IS_TIMED) {
+			start_cycles = ReadCycleCounter();
+		}
+
 		VoidPtr address = m_allocation_policy.Allocate(size, alignment);
 
-		if (m_allocation_stats.m_peak_size < size) {
-			m_allocation_stats.m_peak_size = size;
+		if constexpr (AllocationStats::IS_TIMED) {
+			m_allocation_stats.OnAllocateLatency(ReadCycleCounter() - start_cycles);
 		}
 
-		m_allocation_stats.m_total_size += size;
-		m_allocation_stats.m_num_of_allocations += 1;
+		if (!address) {
+			return nullptr;
+		}
 
-		m_used_space = (m_allocation_stats.m_total_size / m_capacity) * 100.0f;
+		if constexpr (AllocationStats::IS_ENABLED) {
+			m_allocation_stats.OnAllocate(address, size, alignment, GetAccountedSize(address, size));
+		}
 
 		return address;
 	}
-	template<typename AllocationPolicy>
-	FORGE_FORCE_INLINE VoidPtr Allocator<AllocationPolicy>::Callocate(Size size, Byte value, Size alignment)
+	template<typename AllocationPolicy, typename AllocationStats>
+	FORGE_FORCE_INLINE VoidPtr Allocator<AllocationPolicy, AllocationStats>::Callocate(Size size, Byte value, Size alignment)
 	{
 		if (size == 0) {
 			return nullptr;
@@ -106,21 +127,30 @@ namespace Forge
 			return nullptr;
 		}
 
+		Size start_cycles = 0;
+
+		if constexpr (AllocationStats::IS_TIMED) {
+			start_cycles = ReadCycleCounter();
+		}
+
 		VoidPtr address = m_allocation_policy.Callocate(size, value, alignment);
 
-		if (m_allocation_stats.m_peak_size < size) {
-			m_allocation_stats.m_peak_size = size;
+		if constexpr (AllocationStats::IS_TIMED) {
+			m_allocation_stats.OnAllocateLatency(ReadCycleCounter() - start_cycles);
 		}
 
-		m_allocation_stats.m_total_size += size;
-		m_allocation_stats.m_num_of_allocations += 1;
+		if (!address) {
+			return nullptr;
+		}
 
-		m_used_space = (m_allocation_stats.m_total_size / m_capacity) * 100.0f;
+		if constexpr (AllocationStats::IS_ENABLED) {
+			m_allocation_stats.OnCallocate(address, size, value, alignment, GetAccountedSize(address, size));
+		}
 
 		return address;
 	}
-	template<typename AllocationPolicy>
-	FORGE_FORCE_INLINE VoidPtr Allocator<AllocationPolicy>::Reallocate(VoidPtr address, Size size, Size alignment)
+	template<typename AllocationPolicy, typename AllocationStats>
+	FORGE_FORCE_INLINE VoidPtr Allocator<AllocationPolicy, AllocationStats>::Reallocate(VoidPtr address, Size size, Size alignment)
 	{
 		if (size == 0) {
 			this->Deallocate(address);
@@ -131,84 +161,269 @@ namespace Forge
 			return nullptr;
 		}
 
-		m_allocation_stats.m_total_size -= GetAllocatedSize(address);
+		Size old_size = 0;
+
+		if constexpr (AllocationStats::IS_ENABLED) {
+			old_size = address ? m_allocation_policy.GetAllocatedSize(address) : 0;
+		}
+
+		Size start_cycles = 0;
+
+		if constexpr (AllocationStats::IS_TIMED) {
+			start_cycles = ReadCycleCounter();
+		}
 
 		VoidPtr new_address = m_allocation_policy.Reallocate(address, size, alignment);
 
-		if (m_allocation_stats.m_peak_size < size) {
-			m_allocation_stats.m_peak_size = size;
+		if constexpr (AllocationStats::IS_TIMED) {
+			m_allocation_stats.OnReallocateLatency(ReadCycleCounter() - start_cycles);
 		}
 
-		m_allocation_stats.m_total_size += size;
-		m_allocation_stats.m_num_of_allocations += 1;
+		// The old memory block is left untouched if the reallocation fails.
+		if (!new_address) {
+			return nullptr;
+		}
 
-		m_used_space = (m_allocation_stats.m_total_size / m_capacity) * 100.0f;
+		if constexpr (AllocationStats::IS_ENABLED) {
+			m_allocation_stats.OnReallocate(address, new_address, size, alignment, old_size, GetAccountedSize(new_address, size));
+		}
 
 		return new_address;
 	}
+	template<typename AllocationPolicy, typename AllocationStats>
+	FORGE_FORCE_INLINE Size Allocator<AllocationPolicy, AllocationStats>::AllocateBatch(Size size, Size alignment, Size count, VoidPtr* addresses)
+	{
+		if (size == 0 || count == 0) {
+			return 0;
+		}
+
+		if (alignment < 1 || (alignment & (alignment - 1)) != 0) {
+			return 0;
+		}
+
+		Size start_cycles = 0;
+
+		if constexpr (AllocationStats::IS_TIMED) {
+			start_cycles = ReadCycleCounter();
+		}
+
+		Size num_of_blocks = m_allocation_policy.AllocateBatch(size, alignment, count, addresses);
+
+		// The latency histograms count single operations, so the batch is recorded as its average per memory block.
+		if constexpr (AllocationStats::IS_TIMED) {
+			m_allocation_stats.OnAllocateLatency((ReadCycleCounter() - start_cycles) / count);
+		}
+
+		if constexpr (AllocationStats::IS_ENABLED) {
+			if (num_of_blocks) {
+				Size allocated_size = 0;
 
-	template<typename AllocationPolicy>
-	FORGE_FORCE_INLINE Void Allocator<AllocationPolicy>::Deallocate(VoidPtr address)
+				for (Size i = 0; i < num_of_blocks; i++) {
+					allocated_size += GetAccountedSize(addresses[i], size);
+				}
+
+				m_allocation_stats.OnAllocateBatch(addresses, num_of_blocks, size, alignment, allocated_size);
+			}
+		}
+
+		return num_of_blocks;
+	}
+	template<typename AllocationPolicy, typename AllocationStats>
+	FORGE_FORCE_INLINE AllocationResult Allocator<AllocationPolicy, AllocationStats>::AllocateAtLeast(Size size, Size alignment)
 	{
-		m_allocation_stats.m_total_size -= GetAllocatedSize(address);
+		if (size == 0) {
+			return AllocationResult{ nullptr, 0 };
+		}
+
+		if (alignment < 1 || (alignment & (alignment - 1)) != 0) {
+			return AllocationResult{ nullptr, 0 };
+		}
+
+		Size start_cycles = 0;
+
+		if constexpr (AllocationStats::IS_TIMED) {
+			start_cycles = ReadCycleCounter();
+		}
+
+		AllocationResult result = m_allocation_policy.AllocateAtLeast(size, alignment);
+
+		if constexpr (AllocationStats::IS_TIMED) {
+			m_allocation_stats.OnAllocateLatency(ReadCycleCounter() - start_cycles);
+		}
+
+		if (!result.m_address) {
+			return AllocationResult{ nullptr, 0 };
+		}
+
+		if constexpr (AllocationStats::IS_ENABLED) {
+			m_allocation_stats.OnAllocate(result.m_address, size, alignment, GetAccountedSize(result.m_address, result.m_size));
+		}
+
+		return result;
+	}
+
+	template<typename AllocationPolicy, typename AllocationStats>
+	FORGE_FORCE_INLINE Void Allocator<AllocationPolicy, AllocationStats>::Deallocate(VoidPtr address)
+	{
+		if (!address) {
+			return;
+		}
+
+		if constexpr (AllocationStats::IS_ENABLED) {
+			m_allocation_stats.OnDeallocate(address, m_allocation_policy.GetAllocatedSize(address));
+		}
+
+		Size start_cycles = 0;
+
+		if constexpr (AllocationStats::IS_TIMED) {
+			start_cycles = ReadCycleCounter();
+		}
 
 		m_allocation_policy.Deallocate(address);
 
-		m_allocation_stats.m_num_of_deallocations += 1;
+		if constexpr (AllocationStats::IS_TIMED) {
+			m_allocation_stats.OnDeallocateLatency(ReadCycleCounter() - start_cycles);
+		}
+	}
+	template<typename AllocationPolicy, typename AllocationStats>
+	FORGE_FORCE_INLINE Void Allocator<AllocationPolicy, AllocationStats>::Deallocate(VoidPtr address, Size size, Size alignment)
+	{
+		if (!address) {
+			return;
+		}
+
+		// Subtracts the same size as the unsized Deallocate, derived from the size so the memory block is not looked up.
+		if constexpr (AllocationStats::IS_ENABLED) {
+			m_allocation_stats.OnDeallocate(address, m_allocation_policy.GetRoundedSize(address, size, alignment));
+		}
+
+		Size start_cycles = 0;
+
+		if constexpr (AllocationStats::IS_TIMED) {
+			start_cycles = ReadCycleCounter();
+		}
+
+		m_allocation_policy.DeallocateSized(address, size, alignment);
 
-		m_used_space = (m_allocation_stats.m_total_size / m_capacity) * 100.0f;
+		if constexpr (AllocationStats::IS_TIMED) {
+			m_allocation_stats.OnDeallocateLatency(ReadCycleCounter() - start_cycles);
+		}
+	}
+	template<typename AllocationPolicy, typename AllocationStats>
+	FORGE_FORCE_INLINE Void Allocator<AllocationPolicy, AllocationStats>::DeallocateBatch(VoidPtr* addresses, Size count)
+	{
+		if (count == 0) {
+			return;
+		}
+
+		if constexpr (AllocationStats::IS_ENABLED) {
+			Size allocated_size = 0;
+
+			for (Size i = 0; i < count; i++) {
+				allocated_size += m_allocation_policy.GetAllocatedSize(addresses[i]);
+			}
+
+			m_allocation_stats.OnDeallocateBatch(addresses, count, allocated_size);
+		}
+
+		Size start_cycles = 0;
+
+		if constexpr (AllocationStats::IS_TIMED) {
+			start_cycles = ReadCycleCounter();
+		}
+
+		m_allocation_policy.DeallocateBatch(addresses, count);
+
+		if constexpr (AllocationStats::IS_TIMED) {
+			m_allocation_stats.OnDeallocateLatency((ReadCycleCounter() - start_cycles) / count);
+		}
 	}
 
-	template<typename AllocationPolicy>
+	template<typename AllocationPolicy, typename AllocationStats>
 	template<typename InType, typename... Args>
-	FORGE_FORCE_INLINE InType* Allocator<AllocationPolicy>::ConstructObject(Args... arguments)
+	FORGE_FORCE_INLINE InType* Allocator<AllocationPolicy, AllocationStats>::ConstructObject(Args... arguments)
 	{
-		InType* object_address = reinterpret_cast<InType*>(this->Allocate(sizeof(InType)));
+		InType* object_address = reinterpret_cast<InType*>(this->Allocate(sizeof(InType), alignof(InType)));
 
-		ConstructObject(object_address, ::std::forward(arguments... ));
+		if (object_address) {
+			Forge::ConstructObject(object_address, ::std::forward<Args>(arguments)...);
+		}
 
 		return object_address;
 	}
-	template<typename AllocationPolicy>
+	template<typename AllocationPolicy, typename AllocationStats>
 	template<typename InType, typename... Args>
-	FORGE_FORCE_INLINE InType* Allocator<AllocationPolicy>::ConstructArray(Size count, Args... arguments)
+	FORGE_FORCE_INLINE InType* Allocator<AllocationPolicy, AllocationStats>::ConstructArray(Size count, Args... arguments)
 	{
-		InType* object_array_address = reinterpret_cast<InType*>(this->Allocate(sizeof(InType) * count));
+		InType* object_array_address = reinterpret_cast<InType*>(this->Allocate(sizeof(InType) * count, alignof(InType)));
 
-		ConstructArray(object_array_address, count, ::std::forward(arguments...));
+		if (object_array_address) {
+			Forge::ConstructArray(object_array_address, count, ::std::forward<Args>(arguments)...);
+		}
 
 		return object_array_address;
 	}
 
-	template<typename AllocationPolicy>
+	template<typename AllocationPolicy, typename AllocationStats>
 	template<typename InType>
-	FORGE_FORCE_INLINE Void Allocator<AllocationPolicy>::DestructObject(InType* address)
+	FORGE_FORCE_INLINE Void Allocator<AllocationPolicy, AllocationStats>::DestructObject(InType* address)
 	{
-		DestructObject(address);
+		Forge::DestructObject(address);
 
-		this->Deallocate(address);
+		// A polymorphic object may be of a larger derived type, so only its address is known to be exact.
+		if constexpr (::std::is_polymorphic<InType>::value) {
+			this->Deallocate(address);
+		}
+		else {
+			this->Deallocate(address, sizeof(InType), alignof(InType));
+		}
 	}
-	template<typename AllocationPolicy>
+	template<typename AllocationPolicy, typename AllocationStats>
 	template<typename InType>
-	FORGE_FORCE_INLINE Void Allocator<AllocationPolicy>::DestructArray(InType* address, Size count)
+	FORGE_FORCE_INLINE Void Allocator<AllocationPolicy, AllocationStats>::DestructArray(InType* address, Size count)
 	{
-		DestructArray(address, count);
+		Forge::DestructArray(address, count);
 
-		this->Deallocate(address);
+		this->Deallocate(address, sizeof(InType) * count, alignof(InType));
 	}
 
-	template<typename AllocationPolicy>
-	FORGE_FORCE_INLINE Void Allocator<AllocationPolicy>::Reset()
+	template<typename AllocationPolicy, typename AllocationStats>
+	template<typename InMarker>
+	FORGE_FORCE_INLINE Void Allocator<AllocationPolicy, AllocationStats>::FreeToMarker(const InMarker& marker)
 	{
-		m_used_space = 0.0f;
+		if constexpr (AllocationStats::IS_ENABLED) {
+			InMarker current = m_allocation_policy.GetMarker();
+
+			// Deallocating the top-most memory block of an end pops it, until the end is back where the marker left it.
+			while (current.m_bottom_last && current.m_bottom_last != marker.m_bottom_last) {
+				this->Deallocate(current.m_bottom_last);
+				current = m_allocation_policy.GetMarker();
+			}
+
+			while (current.m_top_last && current.m_top_last != marker.m_top_last) {
+				this->Deallocate(current.m_top_last);
+				current = m_allocation_policy.GetMarker();
+			}
+		}
 
-		m_allocation_stats.m_peak_size = 0;
-		m_allocation_stats.m_total_size = 0;
-		m_allocation_stats.m_num_of_allocations = 0;
-		m_allocation_stats.m_num_of_deallocations = 0;
+		m_allocation_policy.FreeToMarker(marker);
+	}
+	template<typename AllocationPolicy, typename AllocationStats>
+	FORGE_FORCE_INLINE Void Allocator<AllocationPolicy, AllocationStats>::Reset()
+	{
+		m_allocation_stats.Reset();
 
 		m_allocation_policy.Reset();
 	}
+
+	template<typename AllocationPolicy, typename AllocationStats>
+	FORGE_FORCE_INLINE Size Allocator<AllocationPolicy, AllocationStats>::GetAccountedSize(VoidPtr address, Size size)
+	{
+		Size allocated_size = m_allocation_policy.GetAllocatedSize(address);
+
+		// Blocks whose size the memory policy cannot tell are never given back before a reset, so the requested size is kept for good.
+		return allocated_size ? allocated_size : size;
+	}
 }
 
 #endif
\ No newline at end of file
@@ -0,0 +1,51 @@
+#ifndef BIT_UTILITIES_INL_HPP
+#define BIT_UTILITIES_INL_HPP
+
+#if defined(_MSC_VER)
+	#include <intrin.h>
+#endif
+
+#include <forge-memory/BitUtilities.hpp>
+
+namespace Forge
+{
+	FORGE_FORCE_INLINE Size BitScanForward(Size value)
+	{
+	#if defined(_MSC_VER)
+		unsigned long index;
+		_BitScanForward64(&index, value);
+		return index;
+	#else
+		return static_cast<Size>(__builtin_ctzll(value));
+	#endif
+	}
+
+	FORGE_FORCE_INLINE Size BitScanReverse(Size value)
+	{
+	#if defined(_MSC_VER)
+		unsigned long index;
+		_BitScanReverse64(&index, value);
+		return index;
+	#else
+		return static_cast<Size>(63 - __builtin_clzll(value));
+	#endif
+	}
+
+	constexpr Bool IsPowerOfTwo(Size value)
+	{
+		return value != 0 && (value & (value - 1)) == 0;
+	}
+
+	constexpr Size NextPowerOfTwo(Size value)
+	{
+		Size result = 1;
+
+		while (result < value) {
+			result <<= 1;
+		}
+
+		return result;
+	}
+}
+
+#endif
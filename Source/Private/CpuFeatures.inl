@@ -0,0 +1,67 @@
+#ifndef CPU_FEATURES_INL_HPP
+#define CPU_FEATURES_INL_HPP
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+	#include <intrin.h>
+	#include <immintrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+	#include <cpuid.h>
+#endif
+
+#include <forge-memory/CpuFeatures.hpp>
+
+namespace Forge
+{
+	FORGE_FORCE_INLINE const CpuFeatures& GetCpuFeatures()
+	{
+		static const CpuFeatures features = []() {
+			CpuFeatures result{ false, false, false };
+
+		#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+			unsigned int registers[4] = {};
+			unsigned int extended_registers[4] = {};
+
+		#if defined(_MSC_VER)
+			__cpuidex(reinterpret_cast<int*>(registers), 1, 0);
+			__cpuidex(reinterpret_cast<int*>(extended_registers), 7, 0);
+		#else
+			__get_cpuid_count(1, 0, &registers[0], &registers[1], &registers[2], &registers[3]);
+			__get_cpuid_count(7, 0, &extended_registers[0], &extended_registers[1], &extended_registers[2], &extended_registers[3]);
+		#endif
+
+			result.m_has_sse2 = (registers[3] & (1u << 26)) != 0;
+
+			// Without OSXSAVE the operating system does not save the upper vector registers, so neither AVX2 nor AVX-512 is usable.
+			if (!(registers[2] & (1u << 27))) {
+				return result;
+			}
+
+		#if defined(_MSC_VER)
+			Size enabled_state = static_cast<Size>(_xgetbv(0));
+		#else
+			unsigned int enabled_state_low = 0;
+			unsigned int enabled_state_high = 0;
+
+			__asm__ volatile("xgetbv" : "=a"(enabled_state_low), "=d"(enabled_state_high) : "c"(0));
+
+			Size enabled_state = enabled_state_low;
+		#endif
+
+			// XMM and YMM state for AVX2, plus the opmask and both halves of the ZMM state for AVX-512.
+			Bool has_avx_state = (enabled_state & 0x06) == 0x06;
+			Bool has_avx512_state = (enabled_state & 0xE6) == 0xE6;
+
+			result.m_has_avx2 = has_avx_state && (extended_registers[1] & (1u << 5)) != 0;
+
+			// The kernels compare bytes, so AVX-512BW is required on top of AVX-512F.
+			result.m_has_avx512 = has_avx512_state && (extended_registers[1] & (1u << 16)) != 0 && (extended_registers[1] & (1u << 30)) != 0;
+		#endif
+
+			return result;
+		}();
+
+		return features;
+	}
+}
+
+#endif
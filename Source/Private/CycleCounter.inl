@@ -0,0 +1,30 @@
+#ifndef CYCLE_COUNTER_INL_HPP
+#define CYCLE_COUNTER_INL_HPP
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+	#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+	#include <x86intrin.h>
+#elif !defined(__aarch64__)
+	#include <chrono>
+#endif
+
+#include <forge-memory/CycleCounter.hpp>
+
+namespace Forge
+{
+	FORGE_FORCE_INLINE Size ReadCycleCounter()
+	{
+	#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+		return static_cast<Size>(__rdtsc());
+	#elif defined(__aarch64__)
+		Size value;
+		asm volatile("mrs %0, cntvct_el0" : "=r"(value));
+		return value;
+	#else
+		return static_cast<Size>(::std::chrono::duration_cast<::std::chrono::nanoseconds>(::std::chrono::steady_clock::now().time_since_epoch()).count());
+	#endif
+	}
+}
+
+#endif
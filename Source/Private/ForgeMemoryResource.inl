@@ -0,0 +1,50 @@
+#ifndef FORGE_MEMORY_RESOURCE_INL_HPP
+#define FORGE_MEMORY_RESOURCE_INL_HPP
+
+#include <new>
+
+#include <forge-memory/ForgeMemoryResource.hpp>
+
+namespace Forge
+{
+	template<typename AllocationPolicy, typename AllocationStats>
+	FORGE_FORCE_INLINE ForgeMemoryResource<AllocationPolicy, AllocationStats>::ForgeMemoryResource(Allocator<AllocationPolicy, AllocationStats>& allocator)
+		: m_allocator(&allocator) {}
+
+	template<typename AllocationPolicy, typename AllocationStats>
+	FORGE_FORCE_INLINE Allocator<AllocationPolicy, AllocationStats>& ForgeMemoryResource<AllocationPolicy, AllocationStats>::GetAllocator() const
+	{
+		return *m_allocator;
+	}
+
+	template<typename AllocationPolicy, typename AllocationStats>
+	FORGE_FORCE_INLINE void* ForgeMemoryResource<AllocationPolicy, AllocationStats>::do_allocate(::std::size_t size, ::std::size_t alignment)
+	{
+		// The allocator refuses empty requests, while a memory resource has to return a unique address for them.
+		VoidPtr address = m_allocator->Allocate(size ? size : 1, alignment);
+
+		if (!address) {
+			throw ::std::bad_alloc();
+		}
+
+		return address;
+	}
+	template<typename AllocationPolicy, typename AllocationStats>
+	FORGE_FORCE_INLINE void ForgeMemoryResource<AllocationPolicy, AllocationStats>::do_deallocate(void* address, ::std::size_t size, ::std::size_t alignment)
+	{
+		m_allocator->Deallocate(address, size ? size : 1, alignment);
+	}
+	template<typename AllocationPolicy, typename AllocationStats>
+	FORGE_FORCE_INLINE bool ForgeMemoryResource<AllocationPolicy, AllocationStats>::do_is_equal(const ::std::pmr::memory_resource& other) const noexcept
+	{
+		if (this == &other) {
+			return true;
+		}
+
+		const ForgeMemoryResource* other_resource = dynamic_cast<const ForgeMemoryResource*>(&other);
+
+		return other_resource && other_resource->m_allocator == m_allocator;
+	}
+}
+
+#endif
@@ -0,0 +1,60 @@
+#ifndef FORGE_STD_ALLOCATOR_INL_HPP
+#define FORGE_STD_ALLOCATOR_INL_HPP
+
+#include <new>
+
+#include <forge-memory/ForgeStdAllocator.hpp>
+
+namespace Forge
+{
+	template<typename InType, typename AllocationPolicy, typename AllocationStats>
+	FORGE_FORCE_INLINE ForgeStdAllocator<InType, AllocationPolicy, AllocationStats>::ForgeStdAllocator(Allocator<AllocationPolicy, AllocationStats>& allocator) noexcept
+		: m_allocator(&allocator) {}
+	template<typename InType, typename AllocationPolicy, typename AllocationStats>
+	template<typename OtherType>
+	FORGE_FORCE_INLINE ForgeStdAllocator<InType, AllocationPolicy, AllocationStats>::ForgeStdAllocator(const ForgeStdAllocator<OtherType, AllocationPolicy, AllocationStats>& other) noexcept
+		: m_allocator(other.m_allocator) {}
+
+	template<typename InType, typename AllocationPolicy, typename AllocationStats>
+	FORGE_FORCE_INLINE Allocator<AllocationPolicy, AllocationStats>& ForgeStdAllocator<InType, AllocationPolicy, AllocationStats>::GetAllocator() const noexcept
+	{
+		return *m_allocator;
+	}
+
+	template<typename InType, typename AllocationPolicy, typename AllocationStats>
+	FORGE_FORCE_INLINE InType* ForgeStdAllocator<InType, AllocationPolicy, AllocationStats>::allocate(::std::size_t count)
+	{
+		if (count > static_cast<::std::size_t>(-1) / sizeof(InType)) {
+			throw ::std::bad_array_new_length();
+		}
+
+		// The allocator refuses empty requests, while a standard allocator may be asked for zero objects.
+		VoidPtr address = m_allocator->Allocate(count ? count * sizeof(InType) : 1, alignof(InType));
+
+		if (!address) {
+			throw ::std::bad_alloc();
+		}
+
+		return reinterpret_cast<InType*>(address);
+	}
+	template<typename InType, typename AllocationPolicy, typename AllocationStats>
+	FORGE_FORCE_INLINE void ForgeStdAllocator<InType, AllocationPolicy, AllocationStats>::deallocate(InType* address, ::std::size_t count)
+	{
+		m_allocator->Deallocate(address, count ? count * sizeof(InType) : 1, alignof(InType));
+	}
+
+	template<typename InType, typename AllocationPolicy, typename AllocationStats>
+	template<typename OtherType>
+	FORGE_FORCE_INLINE bool ForgeStdAllocator<InType, AllocationPolicy, AllocationStats>::operator==(const ForgeStdAllocator<OtherType, AllocationPolicy, AllocationStats>& other) const noexcept
+	{
+		return m_allocator == other.m_allocator;
+	}
+	template<typename InType, typename AllocationPolicy, typename AllocationStats>
+	template<typename OtherType>
+	FORGE_FORCE_INLINE bool ForgeStdAllocator<InType, AllocationPolicy, AllocationStats>::operator!=(const ForgeStdAllocator<OtherType, AllocationPolicy, AllocationStats>& other) const noexcept
+	{
+		return m_allocator != other.m_allocator;
+	}
+}
+
+#endif
@@ -0,0 +1,233 @@
+#ifndef MEMORY_STREAMING_INL_HPP
+#define MEMORY_STREAMING_INL_HPP
+
+#include <system_error>
+
+#include <forge-memory/MemoryKernels.hpp>
+#include <forge-memory/MemoryUtilities.hpp>
+#include <forge-memory/MemoryStreaming.hpp>
+
+namespace Forge
+{
+	FORGE_FORCE_INLINE StreamingWorkerPool::StreamingWorkerPool()
+		: m_task(nullptr), m_context(nullptr), m_num_of_parts(0), m_next_part(0), m_num_of_pending_parts(0), m_generation(0), m_is_stopping(false),
+		  m_streaming_threshold(DEFAULT_STREAMING_THRESHOLD), m_parallel_threshold(DEFAULT_PARALLEL_THRESHOLD), m_max_num_of_threads(DEFAULT_MAX_NUM_OF_STREAMING_THREADS)
+	{
+		Size num_of_cores = ::std::thread::hardware_concurrency();
+
+		if (num_of_cores && num_of_cores < DEFAULT_MAX_NUM_OF_STREAMING_THREADS) {
+			m_max_num_of_threads.store(num_of_cores, ::std::memory_order_relaxed);
+		}
+	}
+
+	FORGE_FORCE_INLINE StreamingWorkerPool::~StreamingWorkerPool()
+	{
+		{
+			::std::lock_guard<::std::mutex> lock(m_mutex);
+			m_is_stopping = true;
+		}
+
+		m_work_condition.notify_all();
+
+		for (::std::thread& worker : m_workers) {
+			worker.join();
+		}
+	}
+
+	FORGE_FORCE_INLINE StreamingWorkerPool& StreamingWorkerPool::Get()
+	{
+		static StreamingWorkerPool pool;
+
+		return pool;
+	}
+
+	FORGE_FORCE_INLINE StreamingSettings StreamingWorkerPool::GetSettings() const
+	{
+		return StreamingSettings{
+			m_streaming_threshold.load(::std::memory_order_relaxed),
+			m_parallel_threshold.load(::std::memory_order_relaxed),
+			m_max_num_of_threads.load(::std::memory_order_relaxed)
+		};
+	}
+	FORGE_FORCE_INLINE Void StreamingWorkerPool::SetSettings(const StreamingSettings& settings)
+	{
+		m_streaming_threshold.store(settings.m_streaming_threshold, ::std::memory_order_relaxed);
+		m_parallel_threshold.store(settings.m_parallel_threshold, ::std::memory_order_relaxed);
+		m_max_num_of_threads.store(settings.m_max_num_of_threads, ::std::memory_order_relaxed);
+	}
+
+	FORGE_FORCE_INLINE Void StreamingWorkerPool::Run(Size num_of_parts, Task task, VoidPtr context)
+	{
+		::std::unique_lock<::std::mutex> run_lock(m_run_mutex, ::std::try_to_lock);
+
+		if (!run_lock.owns_lock() || num_of_parts < 2) {
+			for (Size part_index = 0; part_index < num_of_parts; part_index++) {
+				task(context, part_index, num_of_parts);
+			}
+
+			return;
+		}
+
+		::std::unique_lock<::std::mutex> lock(m_mutex);
+
+		// Workers started now wait for the generation after the current one, which is this run.
+		StartWorkers(num_of_parts - 1, m_generation);
+
+		m_task = task;
+		m_context = context;
+		m_num_of_parts = num_of_parts;
+		m_next_part = 0;
+		m_num_of_pending_parts = num_of_parts;
+		m_generation++;
+
+		m_work_condition.notify_all();
+
+		RunParts(lock);
+
+		m_done_condition.wait(lock, [this]() { return m_num_of_pending_parts == 0; });
+	}
+
+	FORGE_FORCE_INLINE Void StreamingWorkerPool::StartWorkers(Size num_of_workers, Size generation)
+	{
+		while (m_workers.size() < num_of_workers) {
+			// The calling thread runs every part nobody else picks up, so running with fewer workers is only slower.
+			try {
+				m_workers.emplace_back(&StreamingWorkerPool::WorkerMain, this, generation);
+			}
+			catch (const ::std::system_error&) {
+				return;
+			}
+		}
+	}
+	FORGE_FORCE_INLINE Void StreamingWorkerPool::RunParts(::std::unique_lock<::std::mutex>& lock)
+	{
+		while (m_next_part < m_num_of_parts) {
+			Size part_index = m_next_part++;
+
+			Task task = m_task;
+			VoidPtr context = m_context;
+			Size num_of_parts = m_num_of_parts;
+
+			lock.unlock();
+			task(context, part_index, num_of_parts);
+			lock.lock();
+
+			if (--m_num_of_pending_parts == 0) {
+				m_done_condition.notify_all();
+			}
+		}
+	}
+	FORGE_FORCE_INLINE Void StreamingWorkerPool::WorkerMain(Size generation)
+	{
+		::std::unique_lock<::std::mutex> lock(m_mutex);
+
+		for (;;) {
+			m_work_condition.wait(lock, [this, generation]() { return m_is_stopping || m_generation != generation; });
+
+			if (m_is_stopping) {
+				return;
+			}
+
+			// A worker waking up after every part was taken finds nothing left and goes back to waiting.
+			generation = m_generation;
+			RunParts(lock);
+		}
+	}
+
+	FORGE_FORCE_INLINE StreamingSettings GetStreamingSettings()
+	{
+		return StreamingWorkerPool::Get().GetSettings();
+	}
+	FORGE_FORCE_INLINE Void SetStreamingSettings(const StreamingSettings& settings)
+	{
+		StreamingWorkerPool::Get().SetSettings(settings);
+	}
+
+	FORGE_FORCE_INLINE Void MemoryCopyStreaming(VoidPtr destination, ConstVoidPtr source, Size size)
+	{
+		if (!destination || !source)
+			ThrowNullAddress();
+
+		StreamingWorkerPool& pool = StreamingWorkerPool::Get();
+		StreamingSettings settings = pool.GetSettings();
+
+		if (size < settings.m_streaming_threshold) {
+			MemoryCopy(destination, source, size);
+			return;
+		}
+
+		if (size < settings.m_parallel_threshold || settings.m_max_num_of_threads < 2) {
+			GetMemoryKernels().m_copy_streaming(destination, source, size);
+			return;
+		}
+
+		struct CopyContext
+		{
+			Byte*       m_destination;
+			const Byte* m_source;
+			Size        m_size;
+		};
+
+		CopyContext context{ reinterpret_cast<Byte*>(destination), reinterpret_cast<const Byte*>(source), size };
+
+		pool.Run(settings.m_max_num_of_threads, [](VoidPtr context, Size part_index, Size num_of_parts) {
+			CopyContext* copy = reinterpret_cast<CopyContext*>(context);
+
+			// Parts are whole pages of the block, so on a page aligned block no two threads stream into the same cache line.
+			Size part_size = ((copy->m_size + num_of_parts - 1) / num_of_parts + 4095) & ~static_cast<Size>(4095);
+			Size offset = part_index * part_size;
+
+			if (offset >= copy->m_size) {
+				return;
+			}
+
+			Size size = copy->m_size - offset < part_size ? copy->m_size - offset : part_size;
+
+			GetMemoryKernels().m_copy_streaming(copy->m_destination + offset, copy->m_source + offset, size);
+		}, &context);
+	}
+	FORGE_FORCE_INLINE Void MemorySetStreaming(VoidPtr destination, Byte value, Size size)
+	{
+		if (!destination)
+			ThrowNullAddress();
+
+		StreamingWorkerPool& pool = StreamingWorkerPool::Get();
+		StreamingSettings settings = pool.GetSettings();
+
+		if (size < settings.m_streaming_threshold) {
+			MemorySet(destination, value, size);
+			return;
+		}
+
+		if (size < settings.m_parallel_threshold || settings.m_max_num_of_threads < 2) {
+			GetMemoryKernels().m_set_streaming(destination, value, size);
+			return;
+		}
+
+		struct SetContext
+		{
+			Byte* m_destination;
+			Size  m_size;
+			Byte  m_value;
+		};
+
+		SetContext context{ reinterpret_cast<Byte*>(destination), size, value };
+
+		pool.Run(settings.m_max_num_of_threads, [](VoidPtr context, Size part_index, Size num_of_parts) {
+			SetContext* set = reinterpret_cast<SetContext*>(context);
+
+			Size part_size = ((set->m_size + num_of_parts - 1) / num_of_parts + 4095) & ~static_cast<Size>(4095);
+			Size offset = part_index * part_size;
+
+			if (offset >= set->m_size) {
+				return;
+			}
+
+			Size size = set->m_size - offset < part_size ? set->m_size - offset : part_size;
+
+			GetMemoryKernels().m_set_streaming(set->m_destination + offset, set->m_value, size);
+		}, &context);
+	}
+}
+
+#endif
@@ -1,16 +1,26 @@
 #ifndef MEMORY_UTILITIES_INL_HPP
 #define MEMORY_UTILITIES_INL_HPP
 
+#include <new>
 #include <utility>
+#include <cstdint>
 #include <cstring>
 #include <exception>
+#include <stdexcept>
 #include <type_traits>
 
 #include <forge-base/Core/Types.hpp>
 #include <forge-base/Core/System.hpp>
 
+#include <forge-memory/MemoryKernels.hpp>
+
 namespace Forge
 {
+	inline Void ThrowNullAddress()
+	{
+		throw std::invalid_argument("The address arguments must not be a nullptr");
+	}
+
 	FORGE_FORCE_INLINE Void MemoryZero(VoidPtr destination, Size size)
 	{
 		MemorySet(destination, 0, size);
@@ -19,9 +29,62 @@ namespace Forge
 	FORGE_FORCE_INLINE Void MemorySet(VoidPtr destination, Byte value, Size size)
 	{
 		if (!destination)
-			throw std::invalid_argument("The address arguments must not be a nullptr");
+			ThrowNullAddress();
+
+		Byte* destination_bytes = reinterpret_cast<Byte*>(destination);
+
+		// Overlapping stores from both ends cover every size of a range with the same few fixed size stores.
+		if (size <= 16) {
+			if (size >= 8) {
+				memset(destination_bytes, value, 8);
+				memset(destination_bytes + size - 8, value, 8);
+			}
+			else if (size >= 4) {
+				memset(destination_bytes, value, 4);
+				memset(destination_bytes + size - 4, value, 4);
+			}
+			else if (size) {
+				destination_bytes[0] = value;
+				destination_bytes[size / 2] = value;
+				destination_bytes[size - 1] = value;
+			}
+
+			return;
+		}
+
+		if (size <= MAX_INLINE_MEMORY_SIZE) {
+			memset(destination_bytes, value, 16);
+			memset(destination_bytes + size - 16, value, 16);
+
+			if (size > 32) {
+				memset(destination_bytes + 16, value, 16);
+				memset(destination_bytes + size - 32, value, 16);
+			}
+
+			return;
+		}
+
+		GetMemoryKernels().m_set(destination, value, size);
+	}
+	template<Size InSize>
+	FORGE_FORCE_INLINE Void MemorySet(VoidPtr destination, Byte value)
+	{
+		Byte* destination_bytes = reinterpret_cast<Byte*>(destination);
 
-		memset(destination, value, size);
+		if constexpr (InSize > MAX_FIXED_MEMORY_SIZE) {
+			MemorySet(destination, value, InSize);
+		}
+		else if constexpr (InSize > 2 * MEMORY_VECTOR_SIZE) {
+			memset(destination_bytes, value, MEMORY_VECTOR_SIZE);
+			MemorySet<InSize - MEMORY_VECTOR_SIZE>(destination_bytes + MEMORY_VECTOR_SIZE, value);
+		}
+		else if constexpr (InSize > MEMORY_VECTOR_SIZE) {
+			memset(destination_bytes, value, MEMORY_VECTOR_SIZE);
+			memset(destination_bytes + InSize - MEMORY_VECTOR_SIZE, value, MEMORY_VECTOR_SIZE);
+		}
+		else {
+			memset(destination_bytes, value, InSize);
+		}
 	}
 
 	FORGE_FORCE_INLINE Void MemoryMove(VoidPtr destination, VoidPtr source, Size size)
@@ -36,17 +99,148 @@ namespace Forge
 	FORGE_FORCE_INLINE Void MemoryCopy(VoidPtr destination, ConstVoidPtr source, Size size)
 	{
 		if (!destination || !source)
-			throw std::invalid_argument("The address arguments must not be a nullptr");
+			ThrowNullAddress();
 
-		memcpy(destination, source, size);
+		Byte* destination_bytes = reinterpret_cast<Byte*>(destination);
+		const Byte* source_bytes = reinterpret_cast<const Byte*>(source);
+
+		// Overlapping moves from both ends cover every size of a range with the same few fixed size moves.
+		if (size <= 16) {
+			if (size >= 8) {
+				memcpy(destination_bytes, source_bytes, 8);
+				memcpy(destination_bytes + size - 8, source_bytes + size - 8, 8);
+			}
+			else if (size >= 4) {
+				memcpy(destination_bytes, source_bytes, 4);
+				memcpy(destination_bytes + size - 4, source_bytes + size - 4, 4);
+			}
+			else if (size) {
+				destination_bytes[0] = source_bytes[0];
+				destination_bytes[size / 2] = source_bytes[size / 2];
+				destination_bytes[size - 1] = source_bytes[size - 1];
+			}
+
+			return;
+		}
+
+		if (size <= MAX_INLINE_MEMORY_SIZE) {
+			memcpy(destination_bytes, source_bytes, 16);
+			memcpy(destination_bytes + size - 16, source_bytes + size - 16, 16);
+
+			if (size > 32) {
+				memcpy(destination_bytes + 16, source_bytes + 16, 16);
+				memcpy(destination_bytes + size - 32, source_bytes + size - 32, 16);
+			}
+
+			return;
+		}
+
+		GetMemoryKernels().m_copy(destination, source, size);
+	}
+	template<Size InSize>
+	FORGE_FORCE_INLINE Void MemoryCopy(VoidPtr destination, ConstVoidPtr source)
+	{
+		Byte* destination_bytes = reinterpret_cast<Byte*>(destination);
+		const Byte* source_bytes = reinterpret_cast<const Byte*>(source);
+
+		if constexpr (InSize > MAX_FIXED_MEMORY_SIZE) {
+			MemoryCopy(destination, source, InSize);
+		}
+		else if constexpr (InSize > 2 * MEMORY_VECTOR_SIZE) {
+			memcpy(destination_bytes, source_bytes, MEMORY_VECTOR_SIZE);
+			MemoryCopy<InSize - MEMORY_VECTOR_SIZE>(destination_bytes + MEMORY_VECTOR_SIZE, source_bytes + MEMORY_VECTOR_SIZE);
+		}
+		else if constexpr (InSize > MEMORY_VECTOR_SIZE) {
+			// The last vector overlaps the first one, unless the size is exactly two vectors.
+			memcpy(destination_bytes, source_bytes, MEMORY_VECTOR_SIZE);
+			memcpy(destination_bytes + InSize - MEMORY_VECTOR_SIZE, source_bytes + InSize - MEMORY_VECTOR_SIZE, MEMORY_VECTOR_SIZE);
+		}
+		else {
+			memcpy(destination_bytes, source_bytes, InSize);
+		}
 	}
 
 	FORGE_FORCE_INLINE Bool MemoryCompare(ConstVoidPtr self, ConstVoidPtr other, Size size)
 	{
 		if (!self || !other)
-			throw std::invalid_argument("The address arguments must not be a nullptr");
+			ThrowNullAddress();
+
+		const Byte* self_bytes = reinterpret_cast<const Byte*>(self);
+		const Byte* other_bytes = reinterpret_cast<const Byte*>(other);
 
-		return memcmp(self, other, size) == 0 ? true : false;
+		if (size > MAX_INLINE_COMPARE_SIZE) {
+			return GetMemoryKernels().m_compare(self, other, size);
+		}
+
+		// Differences are accumulated and checked once, so the data never decides a branch.
+		auto load_difference = [&](Size offset, auto word) {
+			decltype(word) self_word;
+			decltype(word) other_word;
+
+			memcpy(&self_word, self_bytes + offset, sizeof(word));
+			memcpy(&other_word, other_bytes + offset, sizeof(word));
+
+			return self_word ^ other_word;
+		};
+
+		if (size >= 8) {
+			::std::uint64_t difference = load_difference(0, ::std::uint64_t()) | load_difference(size - 8, ::std::uint64_t());
+
+			if (size > 16) {
+				difference |= load_difference(8, ::std::uint64_t()) | load_difference(size - 16, ::std::uint64_t());
+			}
+
+			return difference == 0;
+		}
+
+		if (size >= 4) {
+			return (load_difference(0, ::std::uint32_t()) | load_difference(size - 4, ::std::uint32_t())) == 0;
+		}
+
+		if (size) {
+			return ((self_bytes[0] ^ other_bytes[0]) | (self_bytes[size / 2] ^ other_bytes[size / 2]) | (self_bytes[size - 1] ^ other_bytes[size - 1])) == 0;
+		}
+
+		return true;
+	}
+	template<Size InSize>
+	FORGE_FORCE_INLINE Bool MemoryCompare(ConstVoidPtr self, ConstVoidPtr other)
+	{
+		const Byte* self_bytes = reinterpret_cast<const Byte*>(self);
+		const Byte* other_bytes = reinterpret_cast<const Byte*>(other);
+
+		// Past a few words the accumulated differences lose to the early exits of the C library compare.
+		if constexpr (InSize > MAX_INLINE_COMPARE_SIZE) {
+			return memcmp(self_bytes, other_bytes, InSize) == 0;
+		}
+		else if constexpr (InSize >= 8) {
+			::std::uint64_t difference = 0;
+
+			for (Size offset = 0; offset + 8 <= InSize; offset += 8) {
+				::std::uint64_t self_word;
+				::std::uint64_t other_word;
+
+				memcpy(&self_word, self_bytes + offset, 8);
+				memcpy(&other_word, other_bytes + offset, 8);
+
+				difference |= self_word ^ other_word;
+			}
+
+			if constexpr (InSize % 8 != 0) {
+				::std::uint64_t self_word;
+				::std::uint64_t other_word;
+
+				memcpy(&self_word, self_bytes + InSize - 8, 8);
+				memcpy(&other_word, other_bytes + InSize - 8, 8);
+
+				difference |= self_word ^ other_word;
+			}
+
+			return difference == 0;
+		}
+		else {
+			return memcmp(self_bytes, other_bytes, InSize) == 0;
+		}
 	}
 
 	FORGE_FORCE_INLINE Size MemoryDistance(VoidPtr start, VoidPtr final)
@@ -54,6 +248,11 @@ namespace Forge
 		return reinterpret_cast<Size>(start) - reinterpret_cast<Size>(final);
 	}
 
+	FORGE_FORCE_INLINE VoidPtr MemoryAlignForward(VoidPtr address, Size alignment)
+	{
+		return reinterpret_cast<VoidPtr>((reinterpret_cast<Size>(address) + (alignment - 1)) & ~(alignment - 1));
+	}
+
 
 	template<typename InType>
 	FORGE_FORCE_INLINE Void MoveObject(InType& self, InType& other)
@@ -145,9 +344,7 @@ namespace Forge
 	template<typename InType, typename... InArgs>
 	FORGE_FORCE_INLINE Void ConstructObject(InType* destination, InArgs&&... arguments)
 	{
-		if(::std::is_pod<InType>::value) {}
-		else
-			new (destination) InType(::std::forward(arguments...));
+		new (destination) InType(::std::forward<InArgs>(arguments)...);
 	}
 
 	template<typename InType>
@@ -161,10 +358,8 @@ namespace Forge
 	template<typename InType, typename... InArgs>
 	FORGE_FORCE_INLINE Void ConstructArray(InType* destination, Size count, InArgs&&... arguments)
 	{
-		if(::std::is_pod<InType>::value) {}
-		else
-			for(Size counter = 0; counter < count; counter++)
-				new (destination + counter) InType(::std::forward(arguments...));
+		for(Size counter = 0; counter < count; counter++)
+			new (destination + counter) InType(arguments...);
 	}
 
 
@@ -0,0 +1,100 @@
+#ifndef PAGE_MAP_INL_HPP
+#define PAGE_MAP_INL_HPP
+
+#include <new>
+
+#include <forge-memory/PageMap.hpp>
+
+namespace Forge
+{
+	template<Size PageShift, Size AddressBits>
+	FORGE_FORCE_INLINE PageMap<PageShift, AddressBits>::PageMap()
+		: m_root() {}
+
+	template<Size PageShift, Size AddressBits>
+	FORGE_FORCE_INLINE PageMap<PageShift, AddressBits>::~PageMap()
+	{
+		this->Clear();
+	}
+
+	template<Size PageShift, Size AddressBits>
+	FORGE_FORCE_INLINE Size PageMap<PageShift, AddressBits>::Get(ConstVoidPtr address) const
+	{
+		Size key = reinterpret_cast<Size>(address) >> PageShift;
+
+		// Nodes are published with release semantics, so a reader never sees a node before it is zeroed.
+		Middle* middle = m_root[(key >> (LEAF_BITS + MIDDLE_BITS)) & (ROOT_LENGTH - 1)].load(::std::memory_order_acquire);
+
+		if (!middle) {
+			return 0;
+		}
+
+		Leaf* leaf = middle->m_leaves[(key >> LEAF_BITS) & (MIDDLE_LENGTH - 1)].load(::std::memory_order_acquire);
+
+		if (!leaf) {
+			return 0;
+		}
+
+		return leaf->m_values[key & (LEAF_LENGTH - 1)];
+	}
+
+	template<Size PageShift, Size AddressBits>
+	FORGE_FORCE_INLINE Bool PageMap<PageShift, AddressBits>::Set(ConstVoidPtr address, Size size, Size value)
+	{
+		Size first_key = reinterpret_cast<Size>(address) >> PageShift;
+		Size last_key = (reinterpret_cast<Size>(address) + (size ? size - 1 : 0)) >> PageShift;
+
+		for (Size key = first_key; key <= last_key; key++) {
+			::std::atomic<Middle*>& root_entry = m_root[(key >> (LEAF_BITS + MIDDLE_BITS)) & (ROOT_LENGTH - 1)];
+			Middle* middle = root_entry.load(::std::memory_order_relaxed);
+
+			if (!middle) {
+				middle = new (::std::nothrow) Middle();
+
+				if (!middle) {
+					return false;
+				}
+
+				root_entry.store(middle, ::std::memory_order_release);
+			}
+
+			::std::atomic<Leaf*>& middle_entry = middle->m_leaves[(key >> LEAF_BITS) & (MIDDLE_LENGTH - 1)];
+			Leaf* leaf = middle_entry.load(::std::memory_order_relaxed);
+
+			if (!leaf) {
+				leaf = new (::std::nothrow) Leaf();
+
+				if (!leaf) {
+					return false;
+				}
+
+				middle_entry.store(leaf, ::std::memory_order_release);
+			}
+
+			leaf->m_values[key & (LEAF_LENGTH - 1)] = value;
+		}
+
+		return true;
+	}
+
+	template<Size PageShift, Size AddressBits>
+	FORGE_FORCE_INLINE Void PageMap<PageShift, AddressBits>::Clear()
+	{
+		for (::std::atomic<Middle*>& root_entry : m_root) {
+			Middle* middle = root_entry.load(::std::memory_order_relaxed);
+
+			if (!middle) {
+				continue;
+			}
+
+			for (::std::atomic<Leaf*>& middle_entry : middle->m_leaves) {
+				delete middle_entry.load(::std::memory_order_relaxed);
+			}
+
+			delete middle;
+			root_entry.store(nullptr, ::std::memory_order_relaxed);
+		}
+	}
+}
+
+#endif
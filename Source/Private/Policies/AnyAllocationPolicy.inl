@@ -0,0 +1,179 @@
+#ifndef ANY_ALLOCATION_POLICY_INL_HPP
+#define ANY_ALLOCATION_POLICY_INL_HPP
+
+#include <utility>
+
+#include <forge-memory/Policies/AnyAllocationPolicy.hpp>
+
+namespace Forge
+{
+	template<typename InPolicy>
+	template<typename... InArgs>
+	FORGE_FORCE_INLINE AnyAllocationPolicy::Model<InPolicy>::Model(InArgs&&... arguments)
+		: m_policy(::std::forward<InArgs>(arguments)...) {}
+
+	template<typename InPolicy>
+	FORGE_FORCE_INLINE Void AnyAllocationPolicy::Model<InPolicy>::Initialize(Size capacity)
+	{
+		m_policy.Initialize(capacity);
+	}
+	template<typename InPolicy>
+	FORGE_FORCE_INLINE Void AnyAllocationPolicy::Model<InPolicy>::Deinitialize()
+	{
+		m_policy.Deinitialize();
+	}
+
+	template<typename InPolicy>
+	FORGE_FORCE_INLINE VoidPtr AnyAllocationPolicy::Model<InPolicy>::Allocate(Size size, Size alignment)
+	{
+		return m_policy.Allocate(size, alignment);
+	}
+	template<typename InPolicy>
+	FORGE_FORCE_INLINE VoidPtr AnyAllocationPolicy::Model<InPolicy>::Callocate(Size size, Byte value, Size alignment)
+	{
+		return m_policy.Callocate(size, value, alignment);
+	}
+	template<typename InPolicy>
+	FORGE_FORCE_INLINE VoidPtr AnyAllocationPolicy::Model<InPolicy>::Reallocate(VoidPtr address, Size size, Size alignment)
+	{
+		return m_policy.Reallocate(address, size, alignment);
+	}
+	template<typename InPolicy>
+	FORGE_FORCE_INLINE Size AnyAllocationPolicy::Model<InPolicy>::AllocateBatch(Size size, Size alignment, Size count, VoidPtr* addresses)
+	{
+		return m_policy.AllocateBatch(size, alignment, count, addresses);
+	}
+	template<typename InPolicy>
+	FORGE_FORCE_INLINE AllocationResult AnyAllocationPolicy::Model<InPolicy>::AllocateAtLeast(Size size, Size alignment)
+	{
+		return m_policy.AllocateAtLeast(size, alignment);
+	}
+
+	template<typename InPolicy>
+	FORGE_FORCE_INLINE Void AnyAllocationPolicy::Model<InPolicy>::Deallocate(VoidPtr address)
+	{
+		m_policy.Deallocate(address);
+	}
+	template<typename InPolicy>
+	FORGE_FORCE_INLINE Void AnyAllocationPolicy::Model<InPolicy>::DeallocateBatch(VoidPtr* addresses, Size count)
+	{
+		m_policy.DeallocateBatch(addresses, count);
+	}
+	template<typename InPolicy>
+	FORGE_FORCE_INLINE Void AnyAllocationPolicy::Model<InPolicy>::DeallocateSized(VoidPtr address, Size size, Size alignment)
+	{
+		m_policy.DeallocateSized(address, size, alignment);
+	}
+	template<typename InPolicy>
+	FORGE_FORCE_INLINE Size AnyAllocationPolicy::Model<InPolicy>::GetAllocatedSize(VoidPtr address)
+	{
+		return m_policy.GetAllocatedSize(address);
+	}
+	template<typename InPolicy>
+	FORGE_FORCE_INLINE Size AnyAllocationPolicy::Model<InPolicy>::GetRoundedSize(VoidPtr address, Size size, Size alignment)
+	{
+		return m_policy.GetRoundedSize(address, size, alignment);
+	}
+
+	template<typename InPolicy>
+	FORGE_FORCE_INLINE Void AnyAllocationPolicy::Model<InPolicy>::Reset()
+	{
+		m_policy.Reset();
+	}
+
+	template<typename InPolicy>
+	FORGE_FORCE_INLINE Bool AnyAllocationPolicy::Model<InPolicy>::IsHugePageBacked() const
+	{
+		return m_policy.IsHugePageBacked();
+	}
+
+	template<typename InPolicy, typename... InArgs>
+	FORGE_FORCE_INLINE InPolicy& AnyAllocationPolicy::Emplace(InArgs&&... arguments)
+	{
+		static_assert(IsAllocationPolicy<InPolicy>::value, "InPolicy does not satisfy the memory policy contract of IAllocationPolicy");
+
+		Model<InPolicy>* model = new Model<InPolicy>(::std::forward<InArgs>(arguments)...);
+		m_policy.reset(model);
+
+		return model->m_policy;
+	}
+	FORGE_FORCE_INLINE Bool AnyAllocationPolicy::HasPolicy() const
+	{
+		return m_policy != nullptr;
+	}
+
+	FORGE_FORCE_INLINE Void AnyAllocationPolicy::Initialize(Size capacity)
+	{
+		if (m_policy) {
+			m_policy->Initialize(capacity);
+		}
+	}
+	FORGE_FORCE_INLINE Void AnyAllocationPolicy::Deinitialize()
+	{
+		if (m_policy) {
+			m_policy->Deinitialize();
+		}
+	}
+
+	FORGE_FORCE_INLINE VoidPtr AnyAllocationPolicy::Allocate(Size size, Size alignment)
+	{
+		return m_policy ? m_policy->Allocate(size, alignment) : nullptr;
+	}
+	FORGE_FORCE_INLINE VoidPtr AnyAllocationPolicy::Callocate(Size size, Byte value, Size alignment)
+	{
+		return m_policy ? m_policy->Callocate(size, value, alignment) : nullptr;
+	}
+	FORGE_FORCE_INLINE VoidPtr AnyAllocationPolicy::Reallocate(VoidPtr address, Size size, Size alignment)
+	{
+		return m_policy ? m_policy->Reallocate(address, size, alignment) : nullptr;
+	}
+	FORGE_FORCE_INLINE Size AnyAllocationPolicy::AllocateBatch(Size size, Size alignment, Size count, VoidPtr* addresses)
+	{
+		return m_policy ? m_policy->AllocateBatch(size, alignment, count, addresses) : 0;
+	}
+	FORGE_FORCE_INLINE AllocationResult AnyAllocationPolicy::AllocateAtLeast(Size size, Size alignment)
+	{
+		return m_policy ? m_policy->AllocateAtLeast(size, alignment) : AllocationResult{ nullptr, 0 };
+	}
+
+	FORGE_FORCE_INLINE Void AnyAllocationPolicy::Deallocate(VoidPtr address)
+	{
+		if (m_policy) {
+			m_policy->Deallocate(address);
+		}
+	}
+	FORGE_FORCE_INLINE Void AnyAllocationPolicy::DeallocateBatch(VoidPtr* addresses, Size count)
+	{
+		if (m_policy) {
+			m_policy->DeallocateBatch(addresses, count);
+		}
+	}
+	FORGE_FORCE_INLINE Void AnyAllocationPolicy::DeallocateSized(VoidPtr address, Size size, Size alignment)
+	{
+		if (m_policy) {
+			m_policy->DeallocateSized(address, size, alignment);
+		}
+	}
+	FORGE_FORCE_INLINE Size AnyAllocationPolicy::GetAllocatedSize(VoidPtr address)
+	{
+		return m_policy ? m_policy->GetAllocatedSize(address) : 0;
+	}
+	FORGE_FORCE_INLINE Size AnyAllocationPolicy::GetRoundedSize(VoidPtr address, Size size, Size alignment)
+	{
+		return m_policy ? m_policy->GetRoundedSize(address, size, alignment) : 0;
+	}
+
+	FORGE_FORCE_INLINE Void AnyAllocationPolicy::Reset()
+	{
+		if (m_policy) {
+			m_policy->Reset();
+		}
+	}
+
+	FORGE_FORCE_INLINE Bool AnyAllocationPolicy::IsHugePageBacked() const
+	{
+		return m_policy ? m_policy->IsHugePageBacked() : false;
+	}
+}
+
+#endif
@@ -0,0 +1,181 @@
+#ifndef BUCKETIZER_ALLOCATION_POLICY_INL_HPP
+#define BUCKETIZER_ALLOCATION_POLICY_INL_HPP
+
+#include <forge-memory/Policies/BucketizerAllocationPolicy.hpp>
+
+namespace Forge
+{
+	template<typename InPolicy, Size MinSize, Size MaxSize, Size StepSize>
+	FORGE_FORCE_INLINE InPolicy& BucketizerAllocationPolicy<InPolicy, MinSize, MaxSize, StepSize>::GetBucket(Size index)
+	{
+		return m_buckets[index];
+	}
+
+	template<typename InPolicy, Size MinSize, Size MaxSize, Size StepSize>
+	FORGE_FORCE_INLINE Void BucketizerAllocationPolicy<InPolicy, MinSize, MaxSize, StepSize>::Initialize(Size capacity)
+	{
+		for (Size i = 0; i < NUM_OF_BUCKETS; i++) {
+			m_buckets[i].Initialize(capacity / NUM_OF_BUCKETS);
+		}
+	}
+	template<typename InPolicy, Size MinSize, Size MaxSize, Size StepSize>
+	FORGE_FORCE_INLINE Void BucketizerAllocationPolicy<InPolicy, MinSize, MaxSize, StepSize>::Deinitialize()
+	{
+		for (Size i = 0; i < NUM_OF_BUCKETS; i++) {
+			m_buckets[i].Deinitialize();
+		}
+	}
+
+	template<typename InPolicy, Size MinSize, Size MaxSize, Size StepSize>
+	FORGE_FORCE_INLINE VoidPtr BucketizerAllocationPolicy<InPolicy, MinSize, MaxSize, StepSize>::Allocate(Size size, Size alignment)
+	{
+		if (!IsInRange(size)) {
+			return nullptr;
+		}
+
+		return m_buckets[GetBucketIndex(size)].Allocate(size, alignment);
+	}
+	template<typename InPolicy, Size MinSize, Size MaxSize, Size StepSize>
+	FORGE_FORCE_INLINE VoidPtr BucketizerAllocationPolicy<InPolicy, MinSize, MaxSize, StepSize>::Callocate(Size size, Byte value, Size alignment)
+	{
+		if (!IsInRange(size)) {
+			return nullptr;
+		}
+
+		return m_buckets[GetBucketIndex(size)].Callocate(size, value, alignment);
+	}
+	template<typename InPolicy, Size MinSize, Size MaxSize, Size StepSize>
+	FORGE_FORCE_INLINE AllocationResult BucketizerAllocationPolicy<InPolicy, MinSize, MaxSize, StepSize>::AllocateAtLeast(Size size, Size alignment)
+	{
+		if (!IsInRange(size)) {
+			return AllocationResult{ nullptr, 0 };
+		}
+
+		Size index = GetBucketIndex(size);
+		Size upper_bound = MinSize + (index + 1) * StepSize - 1;
+
+		if (upper_bound > MaxSize) {
+			upper_bound = MaxSize;
+		}
+
+		AllocationResult result = m_buckets[index].AllocateAtLeast(size, alignment);
+
+		if (result.m_size > upper_bound) {
+			result.m_size = upper_bound;
+		}
+
+		return result;
+	}
+	template<typename InPolicy, Size MinSize, Size MaxSize, Size StepSize>
+	FORGE_FORCE_INLINE VoidPtr BucketizerAllocationPolicy<InPolicy, MinSize, MaxSize, StepSize>::Reallocate(VoidPtr address, Size size, Size alignment)
+	{
+		if (!address) {
+			return this->Allocate(size, alignment);
+		}
+
+		if (!IsInRange(size)) {
+			return nullptr;
+		}
+
+		Size old_index = FindOwner(address);
+		Size new_index = GetBucketIndex(size);
+
+		if (old_index == NUM_OF_BUCKETS) {
+			return nullptr;
+		}
+
+		if (old_index == new_index) {
+			return m_buckets[old_index].Reallocate(address, size, alignment);
+		}
+
+		// Every memory block of a bucket is at least as large as the lower bound of its size range.
+		return ReallocateAcross(m_buckets[old_index], m_buckets[new_index], address, size, alignment, MinSize + old_index * StepSize);
+	}
+	template<typename InPolicy, Size MinSize, Size MaxSize, Size StepSize>
+	FORGE_FORCE_INLINE Size BucketizerAllocationPolicy<InPolicy, MinSize, MaxSize, StepSize>::AllocateBatch(Size size, Size alignment, Size count, VoidPtr* addresses)
+	{
+		if (!IsInRange(size)) {
+			return 0;
+		}
+
+		return m_buckets[GetBucketIndex(size)].AllocateBatch(size, alignment, count, addresses);
+	}
+
+	template<typename InPolicy, Size MinSize, Size MaxSize, Size StepSize>
+	FORGE_FORCE_INLINE Void BucketizerAllocationPolicy<InPolicy, MinSize, MaxSize, StepSize>::Deallocate(VoidPtr address)
+	{
+		Size index = FindOwner(address);
+
+		if (index != NUM_OF_BUCKETS) {
+			m_buckets[index].Deallocate(address);
+		}
+	}
+	template<typename InPolicy, Size MinSize, Size MaxSize, Size StepSize>
+	FORGE_FORCE_INLINE Void BucketizerAllocationPolicy<InPolicy, MinSize, MaxSize, StepSize>::DeallocateSized(VoidPtr address, Size size, Size alignment)
+	{
+		if (address && IsInRange(size)) {
+			m_buckets[GetBucketIndex(size)].DeallocateSized(address, size, alignment);
+		}
+	}
+	template<typename InPolicy, Size MinSize, Size MaxSize, Size StepSize>
+	FORGE_FORCE_INLINE Size BucketizerAllocationPolicy<InPolicy, MinSize, MaxSize, StepSize>::GetAllocatedSize(VoidPtr address)
+	{
+		Size index = FindOwner(address);
+
+		return index != NUM_OF_BUCKETS ? m_buckets[index].GetAllocatedSize(address) : 0;
+	}
+	template<typename InPolicy, Size MinSize, Size MaxSize, Size StepSize>
+	FORGE_FORCE_INLINE Size BucketizerAllocationPolicy<InPolicy, MinSize, MaxSize, StepSize>::GetRoundedSize(VoidPtr address, Size size, Size alignment)
+	{
+		return IsInRange(size) ? m_buckets[GetBucketIndex(size)].GetRoundedSize(address, size, alignment) : 0;
+	}
+	template<typename InPolicy, Size MinSize, Size MaxSize, Size StepSize>
+	FORGE_FORCE_INLINE Bool BucketizerAllocationPolicy<InPolicy, MinSize, MaxSize, StepSize>::Owns(VoidPtr address)
+	{
+		return FindOwner(address) != NUM_OF_BUCKETS;
+	}
+
+	template<typename InPolicy, Size MinSize, Size MaxSize, Size StepSize>
+	FORGE_FORCE_INLINE Void BucketizerAllocationPolicy<InPolicy, MinSize, MaxSize, StepSize>::Reset()
+	{
+		for (Size i = 0; i < NUM_OF_BUCKETS; i++) {
+			m_buckets[i].Reset();
+		}
+	}
+
+	template<typename InPolicy, Size MinSize, Size MaxSize, Size StepSize>
+	FORGE_FORCE_INLINE Bool BucketizerAllocationPolicy<InPolicy, MinSize, MaxSize, StepSize>::IsHugePageBacked() const
+	{
+		for (Size i = 0; i < NUM_OF_BUCKETS; i++) {
+			if (!m_buckets[i].IsHugePageBacked()) {
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	template<typename InPolicy, Size MinSize, Size MaxSize, Size StepSize>
+	FORGE_FORCE_INLINE Bool BucketizerAllocationPolicy<InPolicy, MinSize, MaxSize, StepSize>::IsInRange(Size size)
+	{
+		return size >= MinSize && size <= MaxSize;
+	}
+	template<typename InPolicy, Size MinSize, Size MaxSize, Size StepSize>
+	FORGE_FORCE_INLINE Size BucketizerAllocationPolicy<InPolicy, MinSize, MaxSize, StepSize>::GetBucketIndex(Size size)
+	{
+		return (size - MinSize) / StepSize;
+	}
+	template<typename InPolicy, Size MinSize, Size MaxSize, Size StepSize>
+	FORGE_FORCE_INLINE Size BucketizerAllocationPolicy<InPolicy, MinSize, MaxSize, StepSize>::FindOwner(VoidPtr address)
+	{
+		for (Size i = 0; i < NUM_OF_BUCKETS; i++) {
+			if (m_buckets[i].Owns(address)) {
+				return i;
+			}
+		}
+
+		return NUM_OF_BUCKETS;
+	}
+}
+
+#endif
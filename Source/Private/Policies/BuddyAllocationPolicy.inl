@@ -0,0 +1,328 @@
+#ifndef BUDDY_ALLOCATION_POLICY_INL_HPP
+#define BUDDY_ALLOCATION_POLICY_INL_HPP
+
+#include <stdlib.h>
+
+#include <forge-memory/BitUtilities.hpp>
+#include <forge-memory/MemoryUtilities.hpp>
+#include <forge-memory/Policies/BuddyAllocationPolicy.hpp>
+
+namespace Forge
+{
+	FORGE_FORCE_INLINE BuddyAllocationPolicy::BuddyAllocationPolicy()
+		: m_memory(nullptr), m_start(nullptr), m_max_order(0),
+		  m_free_lists(), m_free_orders(0),
+		  m_buddy_bitmap(nullptr), m_bitmap_offsets(), m_block_orders(nullptr) {}
+
+	FORGE_FORCE_INLINE Size BuddyAllocationPolicy::GetLargestFreeBlock()
+	{
+		return m_free_orders ? MIN_BLOCK_SIZE << BitScanReverse(m_free_orders) : 0;
+	}
+	FORGE_FORCE_INLINE Size BuddyAllocationPolicy::GetAllocatedSize(VoidPtr address)
+	{
+		if (!address) {
+			return 0;
+		}
+
+		Size offset = static_cast<Size>(reinterpret_cast<Byte*>(address) - m_start);
+
+		return MIN_BLOCK_SIZE << m_block_orders[offset >> MIN_BLOCK_SIZE_LOG2];
+	}
+	FORGE_FORCE_INLINE Size BuddyAllocationPolicy::GetRoundedSize(VoidPtr address, Size size, Size alignment)
+	{
+		return address ? MIN_BLOCK_SIZE << GetOrder(size, alignment) : 0;
+	}
+	FORGE_FORCE_INLINE Bool BuddyAllocationPolicy::Owns(VoidPtr address)
+	{
+		return m_start && static_cast<Size>(reinterpret_cast<Byte*>(address) - m_start) < (MIN_BLOCK_SIZE << m_max_order);
+	}
+
+	FORGE_FORCE_INLINE Void BuddyAllocationPolicy::Initialize(Size capacity)
+	{
+		if (capacity < MIN_BLOCK_SIZE) {
+			return;
+		}
+
+		m_max_order = BitScanReverse(capacity) - MIN_BLOCK_SIZE_LOG2;
+
+		if (m_max_order >= MAX_NUM_OF_ORDERS) {
+			m_max_order = MAX_NUM_OF_ORDERS - 1;
+		}
+
+		Size pool_size = MIN_BLOCK_SIZE << m_max_order;
+		Size num_of_blocks = static_cast<Size>(1) << m_max_order;
+
+		// Order k holds 2^(max_order - k - 1) buddy pairs, one bit each.
+		Size num_of_bits = 0;
+
+		for (Size order = 0; order < m_max_order; order++) {
+			m_bitmap_offsets[order] = num_of_bits;
+			num_of_bits += num_of_blocks >> (order + 1);
+		}
+
+		m_memory = malloc(pool_size + POOL_ALIGNMENT - 1);
+		m_buddy_bitmap = reinterpret_cast<Byte*>(malloc((num_of_bits + 7) / 8 + 1));
+		m_block_orders = reinterpret_cast<Byte*>(malloc(num_of_blocks));
+
+		if (!m_memory || !m_buddy_bitmap || !m_block_orders) {
+			this->Deinitialize();
+			return;
+		}
+
+		m_start = reinterpret_cast<Byte*>(MemoryAlignForward(m_memory, POOL_ALIGNMENT));
+
+		this->Reset();
+	}
+	FORGE_FORCE_INLINE Void BuddyAllocationPolicy::Deinitialize()
+	{
+		free(m_memory);
+		free(m_buddy_bitmap);
+		free(m_block_orders);
+
+		m_memory = nullptr;
+		m_start = nullptr;
+		m_max_order = 0;
+
+		m_buddy_bitmap = nullptr;
+		m_block_orders = nullptr;
+
+		for (FreeBlock*& free_list : m_free_lists) {
+			free_list = nullptr;
+		}
+
+		m_free_orders = 0;
+	}
+
+	FORGE_FORCE_INLINE VoidPtr BuddyAllocationPolicy::Allocate(Size size, Size alignment)
+	{
+		Size order = GetOrder(size, alignment);
+
+		if (order > m_max_order || !m_start) {
+			return nullptr;
+		}
+
+		Size available_orders = m_free_orders & (~static_cast<Size>(0) << order);
+
+		if (!available_orders) {
+			return nullptr;
+		}
+
+		Size current_order = BitScanForward(available_orders);
+		Size offset = PopFreeBlock(current_order);
+
+		// Split the block down to the requested order, freeing the upper half at each level.
+		while (current_order > order) {
+			current_order--;
+
+			PushFreeBlock(offset + (MIN_BLOCK_SIZE << current_order), current_order);
+			ToggleBuddyBit(offset, current_order);
+		}
+
+		m_block_orders[offset >> MIN_BLOCK_SIZE_LOG2] = static_cast<Byte>(order);
+
+		return m_start + offset;
+	}
+	FORGE_FORCE_INLINE VoidPtr BuddyAllocationPolicy::Callocate(Size size, Byte value, Size alignment)
+	{
+		VoidPtr address = this->Allocate(size, alignment);
+
+		if (address) {
+			MemorySet(address, value, size);
+		}
+
+		return address;
+	}
+	FORGE_FORCE_INLINE VoidPtr BuddyAllocationPolicy::Reallocate(VoidPtr address, Size size, Size alignment)
+	{
+		if (!address) {
+			return this->Allocate(size, alignment);
+		}
+
+		Size offset = static_cast<Size>(reinterpret_cast<Byte*>(address) - m_start);
+		Size order = m_block_orders[offset >> MIN_BLOCK_SIZE_LOG2];
+		Size new_order = GetOrder(size, alignment);
+
+		if (new_order > m_max_order) {
+			return nullptr;
+		}
+
+		if (new_order <= order && (reinterpret_cast<Size>(address) & (alignment - 1)) == 0) {
+			while (order > new_order) {
+				order--;
+
+				PushFreeBlock(offset + (MIN_BLOCK_SIZE << order), order);
+				ToggleBuddyBit(offset, order);
+			}
+
+			m_block_orders[offset >> MIN_BLOCK_SIZE_LOG2] = static_cast<Byte>(order);
+
+			return address;
+		}
+
+		// The block can grow in place only while it is the lower half of its pair and the upper half is free as a whole.
+		Size grow_order = order;
+
+		while (grow_order < new_order) {
+			Size buddy_bit = m_bitmap_offsets[grow_order] + (offset >> (grow_order + MIN_BLOCK_SIZE_LOG2 + 1));
+
+			if ((offset & (MIN_BLOCK_SIZE << grow_order)) || !(m_buddy_bitmap[buddy_bit >> 3] & (1 << (buddy_bit & 7)))) {
+				break;
+			}
+
+			grow_order++;
+		}
+
+		if (grow_order == new_order) {
+			while (order < new_order) {
+				RemoveFreeBlock(offset + (MIN_BLOCK_SIZE << order), order);
+				ToggleBuddyBit(offset, order);
+
+				order++;
+			}
+
+			m_block_orders[offset >> MIN_BLOCK_SIZE_LOG2] = static_cast<Byte>(order);
+
+			return address;
+		}
+
+		VoidPtr new_address = this->Allocate(size, alignment);
+
+		if (new_address) {
+			Size old_size = MIN_BLOCK_SIZE << order;
+
+			MemoryCopy(new_address, address, old_size < size ? old_size : size);
+
+			this->Deallocate(address);
+		}
+
+		return new_address;
+	}
+
+	FORGE_FORCE_INLINE Void BuddyAllocationPolicy::Deallocate(VoidPtr address)
+	{
+		if (!address) {
+			return;
+		}
+
+		Size offset = static_cast<Size>(reinterpret_cast<Byte*>(address) - m_start);
+
+		ReleaseBlock(offset, m_block_orders[offset >> MIN_BLOCK_SIZE_LOG2]);
+	}
+	FORGE_FORCE_INLINE Void BuddyAllocationPolicy::DeallocateSized(VoidPtr address, Size size, Size alignment)
+	{
+		if (!address) {
+			return;
+		}
+
+		Size offset = static_cast<Size>(reinterpret_cast<Byte*>(address) - m_start);
+
+		ReleaseBlock(offset, GetOrder(size, alignment));
+	}
+
+	FORGE_FORCE_INLINE Void BuddyAllocationPolicy::Reset()
+	{
+		for (FreeBlock*& free_list : m_free_lists) {
+			free_list = nullptr;
+		}
+
+		m_free_orders = 0;
+
+		if (!m_start) {
+			return;
+		}
+
+		Size num_of_bits = m_max_order ? m_bitmap_offsets[m_max_order - 1] + 1 : 0;
+
+		MemoryZero(m_buddy_bitmap, (num_of_bits + 7) / 8 + 1);
+
+		PushFreeBlock(0, m_max_order);
+	}
+
+	FORGE_FORCE_INLINE Size BuddyAllocationPolicy::GetOrder(Size size, Size alignment)
+	{
+		if (alignment > POOL_ALIGNMENT) {
+			return MAX_NUM_OF_ORDERS;
+		}
+
+		Size block_size = size > alignment ? size : alignment;
+
+		if (block_size <= MIN_BLOCK_SIZE) {
+			return 0;
+		}
+
+		return BitScanReverse(block_size - 1) + 1 - MIN_BLOCK_SIZE_LOG2;
+	}
+
+	FORGE_FORCE_INLINE Bool BuddyAllocationPolicy::ToggleBuddyBit(Size offset, Size order)
+	{
+		Size bit = m_bitmap_offsets[order] + (offset >> (order + MIN_BLOCK_SIZE_LOG2 + 1));
+
+		m_buddy_bitmap[bit >> 3] ^= static_cast<Byte>(1 << (bit & 7));
+
+		return (m_buddy_bitmap[bit >> 3] & (1 << (bit & 7))) != 0;
+	}
+
+	FORGE_FORCE_INLINE Void BuddyAllocationPolicy::PushFreeBlock(Size offset, Size order)
+	{
+		FreeBlock* block = reinterpret_cast<FreeBlock*>(m_start + offset);
+		FreeBlock* head = m_free_lists[order];
+
+		block->m_next = head;
+		block->m_previous = nullptr;
+
+		if (head) {
+			head->m_previous = block;
+		}
+
+		m_free_lists[order] = block;
+		m_free_orders |= static_cast<Size>(1) << order;
+	}
+	FORGE_FORCE_INLINE Void BuddyAllocationPolicy::RemoveFreeBlock(Size offset, Size order)
+	{
+		FreeBlock* block = reinterpret_cast<FreeBlock*>(m_start + offset);
+
+		if (block->m_next) {
+			block->m_next->m_previous = block->m_previous;
+		}
+
+		if (block->m_previous) {
+			block->m_previous->m_next = block->m_next;
+		}
+		else {
+			m_free_lists[order] = block->m_next;
+		}
+
+		if (!m_free_lists[order]) {
+			m_free_orders &= ~(static_cast<Size>(1) << order);
+		}
+	}
+	FORGE_FORCE_INLINE Size BuddyAllocationPolicy::PopFreeBlock(Size order)
+	{
+		Size offset = static_cast<Size>(reinterpret_cast<Byte*>(m_free_lists[order]) - m_start);
+
+		RemoveFreeBlock(offset, order);
+
+		if (order < m_max_order) {
+			ToggleBuddyBit(offset, order);
+		}
+
+		return offset;
+	}
+
+	FORGE_FORCE_INLINE Void BuddyAllocationPolicy::ReleaseBlock(Size offset, Size order)
+	{
+		// A cleared bit after toggling means the buddy is free as well, so both merge into their parent.
+		while (order < m_max_order && !ToggleBuddyBit(offset, order)) {
+			Size buddy_offset = offset ^ (MIN_BLOCK_SIZE << order);
+
+			RemoveFreeBlock(buddy_offset, order);
+
+			offset &= ~(MIN_BLOCK_SIZE << order);
+			order++;
+		}
+
+		PushFreeBlock(offset, order);
+	}
+}
+
+#endif
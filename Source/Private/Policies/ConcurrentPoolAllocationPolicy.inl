@@ -0,0 +1,227 @@
+#ifndef CONCURRENT_POOL_ALLOCATION_POLICY_INL_HPP
+#define CONCURRENT_POOL_ALLOCATION_POLICY_INL_HPP
+
+#include <new>
+#include <stdlib.h>
+
+#include <forge-memory/MemoryUtilities.hpp>
+#include <forge-memory/Policies/ConcurrentPoolAllocationPolicy.hpp>
+
+namespace Forge
+{
+	template<Size BlockSize, Size BlockAlignment>
+	FORGE_FORCE_INLINE ConcurrentPoolAllocationPolicy<BlockSize, BlockAlignment>::ConcurrentPoolAllocationPolicy()
+		: m_memory(nullptr), m_start(nullptr), m_num_of_blocks(0), m_head(0), m_num_of_touched_blocks(0) {}
+
+	template<Size BlockSize, Size BlockAlignment>
+	FORGE_FORCE_INLINE Size ConcurrentPoolAllocationPolicy<BlockSize, BlockAlignment>::GetNumOfBlocks()
+	{
+		return m_num_of_blocks;
+	}
+
+	template<Size BlockSize, Size BlockAlignment>
+	FORGE_FORCE_INLINE Void ConcurrentPoolAllocationPolicy<BlockSize, BlockAlignment>::Initialize(Size capacity)
+	{
+		m_memory = malloc(capacity + BLOCK_ALIGNMENT - 1);
+		m_start = reinterpret_cast<Byte*>(MemoryAlignForward(m_memory, BLOCK_ALIGNMENT));
+		m_num_of_blocks = m_memory ? capacity / BLOCK_STRIDE : 0;
+
+		if (m_num_of_blocks > MAX_NUM_OF_BLOCKS) {
+			m_num_of_blocks = MAX_NUM_OF_BLOCKS;
+		}
+
+		this->Reset();
+	}
+	template<Size BlockSize, Size BlockAlignment>
+	FORGE_FORCE_INLINE Void ConcurrentPoolAllocationPolicy<BlockSize, BlockAlignment>::Deinitialize()
+	{
+		free(m_memory);
+
+		m_memory = nullptr;
+		m_start = nullptr;
+		m_num_of_blocks = 0;
+
+		this->Reset();
+	}
+
+	template<Size BlockSize, Size BlockAlignment>
+	FORGE_FORCE_INLINE VoidPtr ConcurrentPoolAllocationPolicy<BlockSize, BlockAlignment>::Allocate(Size size, Size alignment)
+	{
+		if (size > BlockSize || alignment > BLOCK_ALIGNMENT) {
+			return nullptr;
+		}
+
+		// A block freed while the untouched blocks were being exhausted is picked up by the second pass.
+		for (Size pass = 0; pass < 2; pass++) {
+			::std::uint64_t head = m_head.load(::std::memory_order_acquire);
+
+			while (static_cast<::std::uint32_t>(head)) {
+				::std::uint32_t index = static_cast<::std::uint32_t>(head);
+				::std::uint32_t next = GetFreeBlock(index)->load(::std::memory_order_relaxed);
+
+				::std::uint64_t new_head = ((head >> 32) + 1) << 32 | next;
+
+				if (m_head.compare_exchange_weak(head, new_head, ::std::memory_order_acquire, ::std::memory_order_acquire)) {
+					return GetBlock(index);
+				}
+			}
+
+			if (m_num_of_touched_blocks.load(::std::memory_order_relaxed) < m_num_of_blocks) {
+				Size index = m_num_of_touched_blocks.fetch_add(1, ::std::memory_order_relaxed);
+
+				if (index < m_num_of_blocks) {
+					return m_start + index * BLOCK_STRIDE;
+				}
+			}
+		}
+
+		return nullptr;
+	}
+	template<Size BlockSize, Size BlockAlignment>
+	FORGE_FORCE_INLINE VoidPtr ConcurrentPoolAllocationPolicy<BlockSize, BlockAlignment>::Callocate(Size size, Byte value, Size alignment)
+	{
+		VoidPtr address = this->Allocate(size, alignment);
+
+		if (address) {
+			MemorySet(address, value, size);
+		}
+
+		return address;
+	}
+	template<Size BlockSize, Size BlockAlignment>
+	FORGE_FORCE_INLINE VoidPtr ConcurrentPoolAllocationPolicy<BlockSize, BlockAlignment>::Reallocate(VoidPtr address, Size size, Size alignment)
+	{
+		if (size > BlockSize || alignment > BLOCK_ALIGNMENT) {
+			return nullptr;
+		}
+
+		if (!address) {
+			return this->Allocate(size, alignment);
+		}
+
+		return address;
+	}
+	template<Size BlockSize, Size BlockAlignment>
+	FORGE_FORCE_INLINE Size ConcurrentPoolAllocationPolicy<BlockSize, BlockAlignment>::AllocateBatch(Size size, Size alignment, Size count, VoidPtr* addresses)
+	{
+		if (size > BlockSize || alignment > BLOCK_ALIGNMENT) {
+			return 0;
+		}
+
+		Size num_of_blocks = 0;
+
+		// Popping several blocks at once would have to read past the head, which another thread may have handed out already.
+		::std::uint64_t head = m_head.load(::std::memory_order_acquire);
+
+		while (num_of_blocks < count && static_cast<::std::uint32_t>(head)) {
+			::std::uint32_t index = static_cast<::std::uint32_t>(head);
+			::std::uint32_t next = GetFreeBlock(index)->load(::std::memory_order_relaxed);
+
+			::std::uint64_t new_head = ((head >> 32) + 1) << 32 | next;
+
+			if (m_head.compare_exchange_weak(head, new_head, ::std::memory_order_acquire, ::std::memory_order_acquire)) {
+				addresses[num_of_blocks++] = GetBlock(index);
+				head = new_head;
+			}
+		}
+
+		if (num_of_blocks < count && m_num_of_touched_blocks.load(::std::memory_order_relaxed) < m_num_of_blocks) {
+			Size remaining = count - num_of_blocks;
+			Size index = m_num_of_touched_blocks.fetch_add(remaining, ::std::memory_order_relaxed);
+
+			for (Size i = 0; i < remaining && index + i < m_num_of_blocks; i++) {
+				addresses[num_of_blocks++] = m_start + (index + i) * BLOCK_STRIDE;
+			}
+		}
+
+		return num_of_blocks;
+	}
+
+	template<Size BlockSize, Size BlockAlignment>
+	FORGE_FORCE_INLINE Void ConcurrentPoolAllocationPolicy<BlockSize, BlockAlignment>::Deallocate(VoidPtr address)
+	{
+		if (!address) {
+			return;
+		}
+
+		::std::uint32_t index = static_cast<::std::uint32_t>((reinterpret_cast<Byte*>(address) - m_start) / BLOCK_STRIDE) + 1;
+
+		FreeBlock* block = new (address) FreeBlock(0);
+
+		::std::uint64_t head = m_head.load(::std::memory_order_relaxed);
+		::std::uint64_t new_head;
+
+		do {
+			block->store(static_cast<::std::uint32_t>(head), ::std::memory_order_relaxed);
+			new_head = ((head >> 32) + 1) << 32 | index;
+		} while (!m_head.compare_exchange_weak(head, new_head, ::std::memory_order_release, ::std::memory_order_relaxed));
+	}
+	template<Size BlockSize, Size BlockAlignment>
+	FORGE_FORCE_INLINE Void ConcurrentPoolAllocationPolicy<BlockSize, BlockAlignment>::DeallocateBatch(VoidPtr* addresses, Size count)
+	{
+		::std::uint32_t first = 0;
+		FreeBlock* last = nullptr;
+
+		// The chain is linked privately, so only its last block has to be patched while retrying the push.
+		for (Size i = count; i-- > 0;) {
+			if (!addresses[i]) {
+				continue;
+			}
+
+			::std::uint32_t index = static_cast<::std::uint32_t>((reinterpret_cast<Byte*>(addresses[i]) - m_start) / BLOCK_STRIDE) + 1;
+
+			// A thread still popping a stale head may read the link concurrently, so it is written atomically.
+			FreeBlock* block = reinterpret_cast<FreeBlock*>(addresses[i]);
+			block->store(first, ::std::memory_order_relaxed);
+
+			if (!last) {
+				last = block;
+			}
+
+			first = index;
+		}
+
+		if (!last) {
+			return;
+		}
+
+		::std::uint64_t head = m_head.load(::std::memory_order_relaxed);
+		::std::uint64_t new_head;
+
+		do {
+			last->store(static_cast<::std::uint32_t>(head), ::std::memory_order_relaxed);
+			new_head = ((head >> 32) + 1) << 32 | first;
+		} while (!m_head.compare_exchange_weak(head, new_head, ::std::memory_order_release, ::std::memory_order_relaxed));
+	}
+	template<Size BlockSize, Size BlockAlignment>
+	FORGE_FORCE_INLINE Size ConcurrentPoolAllocationPolicy<BlockSize, BlockAlignment>::GetAllocatedSize(VoidPtr address)
+	{
+		return address ? BlockSize : 0;
+	}
+	template<Size BlockSize, Size BlockAlignment>
+	FORGE_FORCE_INLINE Bool ConcurrentPoolAllocationPolicy<BlockSize, BlockAlignment>::Owns(VoidPtr address)
+	{
+		return static_cast<Size>(reinterpret_cast<Byte*>(address) - m_start) < m_num_of_blocks * BLOCK_STRIDE;
+	}
+
+	template<Size BlockSize, Size BlockAlignment>
+	FORGE_FORCE_INLINE Void ConcurrentPoolAllocationPolicy<BlockSize, BlockAlignment>::Reset()
+	{
+		m_head.store(0, ::std::memory_order_relaxed);
+		m_num_of_touched_blocks.store(0, ::std::memory_order_relaxed);
+	}
+
+	template<Size BlockSize, Size BlockAlignment>
+	FORGE_FORCE_INLINE Byte* ConcurrentPoolAllocationPolicy<BlockSize, BlockAlignment>::GetBlock(::std::uint32_t index)
+	{
+		return m_start + static_cast<Size>(index - 1) * BLOCK_STRIDE;
+	}
+	template<Size BlockSize, Size BlockAlignment>
+	FORGE_FORCE_INLINE typename ConcurrentPoolAllocationPolicy<BlockSize, BlockAlignment>::FreeBlock*
+		ConcurrentPoolAllocationPolicy<BlockSize, BlockAlignment>::GetFreeBlock(::std::uint32_t index)
+	{
+		return reinterpret_cast<FreeBlock*>(GetBlock(index));
+	}
+}
+
+#endif
@@ -0,0 +1,131 @@
+#ifndef FALLBACK_ALLOCATION_POLICY_INL_HPP
+#define FALLBACK_ALLOCATION_POLICY_INL_HPP
+
+#include <forge-memory/Policies/FallbackAllocationPolicy.hpp>
+
+namespace Forge
+{
+	template<typename Primary, typename Secondary>
+	FORGE_FORCE_INLINE Primary& FallbackAllocationPolicy<Primary, Secondary>::GetPrimary()
+	{
+		return m_primary;
+	}
+	template<typename Primary, typename Secondary>
+	FORGE_FORCE_INLINE Secondary& FallbackAllocationPolicy<Primary, Secondary>::GetSecondary()
+	{
+		return m_secondary;
+	}
+
+	template<typename Primary, typename Secondary>
+	FORGE_FORCE_INLINE Void FallbackAllocationPolicy<Primary, Secondary>::Initialize(Size capacity)
+	{
+		m_primary.Initialize(capacity);
+		m_secondary.Initialize(capacity);
+	}
+	template<typename Primary, typename Secondary>
+	FORGE_FORCE_INLINE Void FallbackAllocationPolicy<Primary, Secondary>::Deinitialize()
+	{
+		m_primary.Deinitialize();
+		m_secondary.Deinitialize();
+	}
+
+	template<typename Primary, typename Secondary>
+	FORGE_FORCE_INLINE VoidPtr FallbackAllocationPolicy<Primary, Secondary>::Allocate(Size size, Size alignment)
+	{
+		VoidPtr address = m_primary.Allocate(size, alignment);
+
+		return address ? address : m_secondary.Allocate(size, alignment);
+	}
+	template<typename Primary, typename Secondary>
+	FORGE_FORCE_INLINE VoidPtr FallbackAllocationPolicy<Primary, Secondary>::Callocate(Size size, Byte value, Size alignment)
+	{
+		VoidPtr address = m_primary.Callocate(size, value, alignment);
+
+		return address ? address : m_secondary.Callocate(size, value, alignment);
+	}
+	template<typename Primary, typename Secondary>
+	FORGE_FORCE_INLINE AllocationResult FallbackAllocationPolicy<Primary, Secondary>::AllocateAtLeast(Size size, Size alignment)
+	{
+		AllocationResult result = m_primary.AllocateAtLeast(size, alignment);
+
+		return result.m_address ? result : m_secondary.AllocateAtLeast(size, alignment);
+	}
+	template<typename Primary, typename Secondary>
+	FORGE_FORCE_INLINE VoidPtr FallbackAllocationPolicy<Primary, Secondary>::Reallocate(VoidPtr address, Size size, Size alignment)
+	{
+		if (!address) {
+			return this->Allocate(size, alignment);
+		}
+
+		if (!m_primary.Owns(address)) {
+			return m_secondary.Reallocate(address, size, alignment);
+		}
+
+		VoidPtr new_address = m_primary.Reallocate(address, size, alignment);
+
+		return new_address ? new_address : ReallocateAcross(m_primary, m_secondary, address, size, alignment, 0);
+	}
+	template<typename Primary, typename Secondary>
+	FORGE_FORCE_INLINE Size FallbackAllocationPolicy<Primary, Secondary>::AllocateBatch(Size size, Size alignment, Size count, VoidPtr* addresses)
+	{
+		Size num_of_blocks = m_primary.AllocateBatch(size, alignment, count, addresses);
+
+		if (num_of_blocks < count) {
+			num_of_blocks += m_secondary.AllocateBatch(size, alignment, count - num_of_blocks, addresses + num_of_blocks);
+		}
+
+		return num_of_blocks;
+	}
+
+	template<typename Primary, typename Secondary>
+	FORGE_FORCE_INLINE Void FallbackAllocationPolicy<Primary, Secondary>::Deallocate(VoidPtr address)
+	{
+		if (m_primary.Owns(address)) {
+			m_primary.Deallocate(address);
+		}
+		else {
+			m_secondary.Deallocate(address);
+		}
+	}
+	template<typename Primary, typename Secondary>
+	FORGE_FORCE_INLINE Void FallbackAllocationPolicy<Primary, Secondary>::DeallocateSized(VoidPtr address, Size size, Size alignment)
+	{
+		if (m_primary.Owns(address)) {
+			m_primary.DeallocateSized(address, size, alignment);
+		}
+		else {
+			m_secondary.DeallocateSized(address, size, alignment);
+		}
+	}
+	template<typename Primary, typename Secondary>
+	FORGE_FORCE_INLINE Size FallbackAllocationPolicy<Primary, Secondary>::GetAllocatedSize(VoidPtr address)
+	{
+		return m_primary.Owns(address) ? m_primary.GetAllocatedSize(address) : m_secondary.GetAllocatedSize(address);
+	}
+	template<typename Primary, typename Secondary>
+	FORGE_FORCE_INLINE Size FallbackAllocationPolicy<Primary, Secondary>::GetRoundedSize(VoidPtr address, Size size, Size alignment)
+	{
+		return m_primary.Owns(address) ? m_primary.GetRoundedSize(address, size, alignment) : m_secondary.GetRoundedSize(address, size, alignment);
+	}
+	template<typename Primary, typename Secondary>
+	template<typename InSecondary, typename>
+	FORGE_FORCE_INLINE Bool FallbackAllocationPolicy<Primary, Secondary>::Owns(VoidPtr address)
+	{
+		return m_primary.Owns(address) || m_secondary.Owns(address);
+	}
+
+	template<typename Primary, typename Secondary>
+	FORGE_FORCE_INLINE Void FallbackAllocationPolicy<Primary, Secondary>::Reset()
+	{
+		m_primary.Reset();
+		m_secondary.Reset();
+	}
+
+	template<typename Primary, typename Secondary>
+	FORGE_FORCE_INLINE Bool FallbackAllocationPolicy<Primary, Secondary>::IsHugePageBacked() const
+	{
+		return m_primary.IsHugePageBacked() && m_secondary.IsHugePageBacked();
+	}
+}
+
+#endif
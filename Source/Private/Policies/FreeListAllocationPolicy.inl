@@ -0,0 +1,474 @@
+#ifndef FREE_LIST_ALLOCATION_POLICY_INL_HPP
+#define FREE_LIST_ALLOCATION_POLICY_INL_HPP
+
+#include <stdlib.h>
+
+#include <forge-memory/BitUtilities.hpp>
+#include <forge-memory/MemoryUtilities.hpp>
+#include <forge-memory/Policies/FreeListAllocationPolicy.hpp>
+
+namespace Forge
+{
+	FORGE_FORCE_INLINE FreeListAllocationPolicy::FreeListAllocationPolicy()
+		: m_memory(nullptr), m_capacity(0), m_is_memory_owned(false), m_fl_bitmap(0), m_sl_bitmap(), m_blocks() {}
+
+	FORGE_FORCE_INLINE Size FreeListAllocationPolicy::GetAllocatedSize(VoidPtr address)
+	{
+		return address ? GetSize(GetBlock(address)) : 0;
+	}
+	FORGE_FORCE_INLINE Bool FreeListAllocationPolicy::Owns(VoidPtr address)
+	{
+		return static_cast<Size>(reinterpret_cast<Byte*>(address) - reinterpret_cast<Byte*>(m_memory)) < m_capacity;
+	}
+
+	FORGE_FORCE_INLINE Void FreeListAllocationPolicy::Initialize(Size capacity)
+	{
+		m_memory = malloc(capacity);
+		m_capacity = m_memory ? capacity : 0;
+		m_is_memory_owned = true;
+
+		this->Reset();
+	}
+	FORGE_FORCE_INLINE Void FreeListAllocationPolicy::Initialize(VoidPtr memory, Size capacity)
+	{
+		m_memory = memory;
+		m_capacity = m_memory ? capacity : 0;
+		m_is_memory_owned = false;
+
+		this->Reset();
+	}
+	FORGE_FORCE_INLINE Void FreeListAllocationPolicy::Deinitialize()
+	{
+		if (m_is_memory_owned) {
+			free(m_memory);
+		}
+
+		m_memory = nullptr;
+		m_capacity = 0;
+		m_is_memory_owned = false;
+
+		this->Reset();
+	}
+
+	FORGE_FORCE_INLINE VoidPtr FreeListAllocationPolicy::Allocate(Size size, Size alignment)
+	{
+		Size adjusted_size = AdjustRequestSize(size, ALIGNMENT);
+
+		if (!adjusted_size) {
+			return nullptr;
+		}
+
+		if (alignment <= ALIGNMENT) {
+			return PrepareUsedBlock(LocateFreeBlock(adjusted_size), adjusted_size);
+		}
+
+		// Over-allocate so that an aligned address with room for a leading free block always exists.
+		Size gap_minimum = sizeof(BlockHeader);
+		Size size_with_gap = AdjustRequestSize(adjusted_size + alignment + gap_minimum, alignment);
+
+		if (!size_with_gap) {
+			return nullptr;
+		}
+
+		BlockHeader* block = LocateFreeBlock(size_with_gap);
+
+		if (block) {
+			Byte* address = GetAddress(block);
+			Byte* aligned = reinterpret_cast<Byte*>(MemoryAlignForward(address, alignment));
+			Size gap = static_cast<Size>(aligned - address);
+
+			if (gap && gap < gap_minimum) {
+				Size gap_remain = gap_minimum - gap;
+				Size offset = gap_remain > alignment ? gap_remain : alignment;
+
+				aligned = reinterpret_cast<Byte*>(MemoryAlignForward(aligned + offset, alignment));
+				gap = static_cast<Size>(aligned - address);
+			}
+
+			if (gap) {
+				block = TrimFreeLeading(block, gap);
+			}
+		}
+
+		return PrepareUsedBlock(block, adjusted_size);
+	}
+	FORGE_FORCE_INLINE VoidPtr FreeListAllocationPolicy::Callocate(Size size, Byte value, Size alignment)
+	{
+		VoidPtr address = this->Allocate(size, alignment);
+
+		if (address) {
+			MemorySet(address, value, size);
+		}
+
+		return address;
+	}
+	FORGE_FORCE_INLINE VoidPtr FreeListAllocationPolicy::Reallocate(VoidPtr address, Size size, Size alignment)
+	{
+		if (!address) {
+			return this->Allocate(size, alignment);
+		}
+
+		BlockHeader* block = GetBlock(address);
+		BlockHeader* next = GetNext(block);
+
+		Size current_size = GetSize(block);
+		Size combined_size = current_size + GetSize(next) + BLOCK_HEADER_OVERHEAD;
+		Size adjusted_size = AdjustRequestSize(size, ALIGNMENT);
+
+		if (!adjusted_size) {
+			return nullptr;
+		}
+
+		Bool is_aligned = (reinterpret_cast<Size>(address) & (alignment - 1)) == 0;
+
+		if (!is_aligned || (adjusted_size > current_size && (!IsFree(next) || adjusted_size > combined_size))) {
+			VoidPtr new_address = this->Allocate(size, alignment);
+
+			if (new_address) {
+				MemoryCopy(new_address, address, current_size < size ? current_size : size);
+
+				this->Deallocate(address);
+			}
+
+			return new_address;
+		}
+
+		if (adjusted_size > current_size) {
+			MergeNext(block);
+			MarkAsUsed(block);
+		}
+
+		TrimUsed(block, adjusted_size);
+
+		return address;
+	}
+
+	FORGE_FORCE_INLINE Void FreeListAllocationPolicy::Deallocate(VoidPtr address)
+	{
+		if (!address) {
+			return;
+		}
+
+		BlockHeader* block = GetBlock(address);
+
+		MarkAsFree(block);
+
+		block = MergePrevious(block);
+		block = MergeNext(block);
+
+		InsertBlock(block);
+	}
+
+	FORGE_FORCE_INLINE Void FreeListAllocationPolicy::Reset()
+	{
+		m_fl_bitmap = 0;
+
+		for (Size fl = 0; fl < FL_INDEX_COUNT; fl++) {
+			m_sl_bitmap[fl] = 0;
+
+			for (Size sl = 0; sl < SL_INDEX_COUNT; sl++) {
+				m_blocks[fl][sl] = nullptr;
+			}
+		}
+
+		Size pool_size = ((m_capacity - (m_capacity < 2 * BLOCK_HEADER_OVERHEAD ? m_capacity : 2 * BLOCK_HEADER_OVERHEAD)) & ~(ALIGNMENT - 1));
+
+		if (!m_memory || pool_size < BLOCK_SIZE_MIN) {
+			return;
+		}
+
+		if (pool_size > BLOCK_SIZE_MAX) {
+			pool_size = BLOCK_SIZE_MAX;
+		}
+
+		// The first block starts one word before the memory pool, its previous physical field is never accessed.
+		BlockHeader* block = reinterpret_cast<BlockHeader*>(reinterpret_cast<Byte*>(m_memory) - BLOCK_HEADER_OVERHEAD);
+
+		block->m_size = pool_size | BLOCK_FREE_BIT;
+
+		InsertBlock(block);
+
+		// A zero sized used sentinel terminates the memory pool so blocks never merge past its end.
+		BlockHeader* sentinel = LinkNext(block);
+		sentinel->m_size = BLOCK_PREVIOUS_FREE_BIT;
+	}
+
+	FORGE_FORCE_INLINE Size FreeListAllocationPolicy::GetSize(BlockHeader* block)
+	{
+		return block->m_size & ~(BLOCK_FREE_BIT | BLOCK_PREVIOUS_FREE_BIT);
+	}
+	FORGE_FORCE_INLINE Void FreeListAllocationPolicy::SetSize(BlockHeader* block, Size size)
+	{
+		block->m_size = size | (block->m_size & (BLOCK_FREE_BIT | BLOCK_PREVIOUS_FREE_BIT));
+	}
+
+	FORGE_FORCE_INLINE Bool FreeListAllocationPolicy::IsFree(BlockHeader* block)
+	{
+		return (block->m_size & BLOCK_FREE_BIT) != 0;
+	}
+	FORGE_FORCE_INLINE Bool FreeListAllocationPolicy::IsPreviousFree(BlockHeader* block)
+	{
+		return (block->m_size & BLOCK_PREVIOUS_FREE_BIT) != 0;
+	}
+
+	FORGE_FORCE_INLINE FreeListAllocationPolicy::BlockHeader* FreeListAllocationPolicy::GetBlock(VoidPtr address)
+	{
+		return reinterpret_cast<BlockHeader*>(reinterpret_cast<Byte*>(address) - BLOCK_START_OFFSET);
+	}
+	FORGE_FORCE_INLINE Byte* FreeListAllocationPolicy::GetAddress(BlockHeader* block)
+	{
+		return reinterpret_cast<Byte*>(block) + BLOCK_START_OFFSET;
+	}
+	FORGE_FORCE_INLINE FreeListAllocationPolicy::BlockHeader* FreeListAllocationPolicy::GetNext(BlockHeader* block)
+	{
+		return reinterpret_cast<BlockHeader*>(GetAddress(block) + GetSize(block) - BLOCK_HEADER_OVERHEAD);
+	}
+	FORGE_FORCE_INLINE FreeListAllocationPolicy::BlockHeader* FreeListAllocationPolicy::LinkNext(BlockHeader* block)
+	{
+		BlockHeader* next = GetNext(block);
+		next->m_previous_physical = block;
+
+		return next;
+	}
+
+	FORGE_FORCE_INLINE Void FreeListAllocationPolicy::MarkAsFree(BlockHeader* block)
+	{
+		BlockHeader* next = LinkNext(block);
+
+		next->m_size |= BLOCK_PREVIOUS_FREE_BIT;
+		block->m_size |= BLOCK_FREE_BIT;
+	}
+	FORGE_FORCE_INLINE Void FreeListAllocationPolicy::MarkAsUsed(BlockHeader* block)
+	{
+		BlockHeader* next = GetNext(block);
+
+		next->m_size &= ~BLOCK_PREVIOUS_FREE_BIT;
+		block->m_size &= ~BLOCK_FREE_BIT;
+	}
+
+	FORGE_FORCE_INLINE Size FreeListAllocationPolicy::AdjustRequestSize(Size size, Size alignment)
+	{
+		if (!size) {
+			return 0;
+		}
+
+		Size aligned_size = (size + (alignment - 1)) & ~(alignment - 1);
+
+		if (aligned_size < size || aligned_size >= BLOCK_SIZE_MAX) {
+			return 0;
+		}
+
+		return aligned_size < BLOCK_SIZE_MIN ? BLOCK_SIZE_MIN : aligned_size;
+	}
+
+	FORGE_FORCE_INLINE Void FreeListAllocationPolicy::MappingInsert(Size size, Size& fl, Size& sl)
+	{
+		if (size < SMALL_BLOCK_SIZE) {
+			fl = 0;
+			sl = size / (SMALL_BLOCK_SIZE / SL_INDEX_COUNT);
+		}
+		else {
+			fl = BitScanReverse(size);
+			sl = (size >> (fl - SL_INDEX_COUNT_LOG2)) ^ SL_INDEX_COUNT;
+			fl -= FL_INDEX_SHIFT - 1;
+		}
+	}
+	FORGE_FORCE_INLINE Void FreeListAllocationPolicy::MappingSearch(Size size, Size& fl, Size& sl)
+	{
+		// Round up to the next list so that any block found is guaranteed to be large enough.
+		if (size >= SMALL_BLOCK_SIZE) {
+			size += (static_cast<Size>(1) << (BitScanReverse(size) - SL_INDEX_COUNT_LOG2)) - 1;
+		}
+
+		MappingInsert(size, fl, sl);
+	}
+
+	FORGE_FORCE_INLINE FreeListAllocationPolicy::BlockHeader* FreeListAllocationPolicy::SearchSuitableBlock(Size& fl, Size& sl)
+	{
+		Size sl_map = m_sl_bitmap[fl] & (~static_cast<Size>(0) << sl);
+
+		if (!sl_map) {
+			Size fl_map = fl + 1 < FL_INDEX_COUNT ? m_fl_bitmap & (~static_cast<Size>(0) << (fl + 1)) : 0;
+
+			if (!fl_map) {
+				return nullptr;
+			}
+
+			fl = BitScanForward(fl_map);
+			sl_map = m_sl_bitmap[fl];
+		}
+
+		sl = BitScanForward(sl_map);
+
+		return m_blocks[fl][sl];
+	}
+
+	FORGE_FORCE_INLINE Void FreeListAllocationPolicy::InsertFreeBlock(BlockHeader* block, Size fl, Size sl)
+	{
+		BlockHeader* current = m_blocks[fl][sl];
+
+		block->m_next_free = current;
+		block->m_previous_free = nullptr;
+
+		if (current) {
+			current->m_previous_free = block;
+		}
+
+		m_blocks[fl][sl] = block;
+
+		m_fl_bitmap |= static_cast<Size>(1) << fl;
+		m_sl_bitmap[fl] |= static_cast<Size>(1) << sl;
+	}
+	FORGE_FORCE_INLINE Void FreeListAllocationPolicy::RemoveFreeBlock(BlockHeader* block, Size fl, Size sl)
+	{
+		BlockHeader* previous = block->m_previous_free;
+		BlockHeader* next = block->m_next_free;
+
+		if (next) {
+			next->m_previous_free = previous;
+		}
+
+		if (previous) {
+			previous->m_next_free = next;
+			return;
+		}
+
+		m_blocks[fl][sl] = next;
+
+		if (!next) {
+			m_sl_bitmap[fl] &= ~(static_cast<Size>(1) << sl);
+
+			if (!m_sl_bitmap[fl]) {
+				m_fl_bitmap &= ~(static_cast<Size>(1) << fl);
+			}
+		}
+	}
+
+	FORGE_FORCE_INLINE Void FreeListAllocationPolicy::InsertBlock(BlockHeader* block)
+	{
+		Size fl, sl;
+		MappingInsert(GetSize(block), fl, sl);
+
+		InsertFreeBlock(block, fl, sl);
+	}
+	FORGE_FORCE_INLINE Void FreeListAllocationPolicy::RemoveBlock(BlockHeader* block)
+	{
+		Size fl, sl;
+		MappingInsert(GetSize(block), fl, sl);
+
+		RemoveFreeBlock(block, fl, sl);
+	}
+
+	FORGE_FORCE_INLINE FreeListAllocationPolicy::BlockHeader* FreeListAllocationPolicy::SplitBlock(BlockHeader* block, Size size)
+	{
+		BlockHeader* remaining = reinterpret_cast<BlockHeader*>(GetAddress(block) + size - BLOCK_HEADER_OVERHEAD);
+
+		remaining->m_size = GetSize(block) - (size + BLOCK_HEADER_OVERHEAD);
+		SetSize(block, size);
+
+		MarkAsFree(remaining);
+
+		return remaining;
+	}
+	FORGE_FORCE_INLINE FreeListAllocationPolicy::BlockHeader* FreeListAllocationPolicy::AbsorbBlock(BlockHeader* previous, BlockHeader* block)
+	{
+		previous->m_size += GetSize(block) + BLOCK_HEADER_OVERHEAD;
+
+		LinkNext(previous);
+
+		return previous;
+	}
+
+	FORGE_FORCE_INLINE FreeListAllocationPolicy::BlockHeader* FreeListAllocationPolicy::MergePrevious(BlockHeader* block)
+	{
+		if (IsPreviousFree(block)) {
+			BlockHeader* previous = block->m_previous_physical;
+
+			RemoveBlock(previous);
+
+			block = AbsorbBlock(previous, block);
+		}
+
+		return block;
+	}
+	FORGE_FORCE_INLINE FreeListAllocationPolicy::BlockHeader* FreeListAllocationPolicy::MergeNext(BlockHeader* block)
+	{
+		BlockHeader* next = GetNext(block);
+
+		if (IsFree(next)) {
+			RemoveBlock(next);
+
+			block = AbsorbBlock(block, next);
+		}
+
+		return block;
+	}
+
+	FORGE_FORCE_INLINE Void FreeListAllocationPolicy::TrimFree(BlockHeader* block, Size size)
+	{
+		if (GetSize(block) >= sizeof(BlockHeader) + size) {
+			BlockHeader* remaining = SplitBlock(block, size);
+
+			LinkNext(block);
+			remaining->m_size |= BLOCK_PREVIOUS_FREE_BIT;
+
+			InsertBlock(remaining);
+		}
+	}
+	FORGE_FORCE_INLINE Void FreeListAllocationPolicy::TrimUsed(BlockHeader* block, Size size)
+	{
+		if (GetSize(block) >= sizeof(BlockHeader) + size) {
+			BlockHeader* remaining = SplitBlock(block, size);
+			remaining->m_size &= ~BLOCK_PREVIOUS_FREE_BIT;
+
+			remaining = MergeNext(remaining);
+
+			InsertBlock(remaining);
+		}
+	}
+	FORGE_FORCE_INLINE FreeListAllocationPolicy::BlockHeader* FreeListAllocationPolicy::TrimFreeLeading(BlockHeader* block, Size size)
+	{
+		BlockHeader* remaining = block;
+
+		if (GetSize(block) >= sizeof(BlockHeader) + size) {
+			remaining = SplitBlock(block, size - BLOCK_HEADER_OVERHEAD);
+			remaining->m_size |= BLOCK_PREVIOUS_FREE_BIT;
+
+			LinkNext(block);
+			InsertBlock(block);
+		}
+
+		return remaining;
+	}
+
+	FORGE_FORCE_INLINE FreeListAllocationPolicy::BlockHeader* FreeListAllocationPolicy::LocateFreeBlock(Size size)
+	{
+		Size fl, sl;
+		MappingSearch(size, fl, sl);
+
+		if (fl >= FL_INDEX_COUNT) {
+			return nullptr;
+		}
+
+		BlockHeader* block = SearchSuitableBlock(fl, sl);
+
+		if (block) {
+			RemoveFreeBlock(block, fl, sl);
+		}
+
+		return block;
+	}
+	FORGE_FORCE_INLINE VoidPtr FreeListAllocationPolicy::PrepareUsedBlock(BlockHeader* block, Size size)
+	{
+		if (!block) {
+			return nullptr;
+		}
+
+		TrimFree(block, size);
+		MarkAsUsed(block);
+
+		return GetAddress(block);
+	}
+}
+
+#endif
@@ -2,47 +2,251 @@
 #define HEAP_ALLOCATION_POLICY_INL_HPP
 
 #include <stdlib.h>
+#include <stddef.h>
+
+#if defined(_WIN32)
+	#include <malloc.h>
+#elif defined(__APPLE__)
+	#include <malloc/malloc.h>
+#else
+	#include <malloc.h>
+#endif
 
 #include <forge-memory/MemoryUtilities.hpp>
-#include <forge-memory/Policies/NoAllocationPolicy.hpp>
+#include <forge-memory/Policies/HeapAllocationPolicy.hpp>
 
 namespace Forge
 {
-	Void HeapAllocationPolicy::Initialize(Size capacity)
+	FORGE_FORCE_INLINE Void HeapAllocationPolicy::Initialize(Size capacity)
 	{
 		// Do Nothing
 	}
-	Void HeapAllocationPolicy::Deinitialize()
+	FORGE_FORCE_INLINE Void HeapAllocationPolicy::Deinitialize()
 	{
 		// Do Nothing
 	}
 
-	VoidPtr HeapAllocationPolicy::Allocate(Size size, Size alignment)
+	FORGE_FORCE_INLINE VoidPtr HeapAllocationPolicy::Allocate(Size size, Size alignment)
 	{
-		return _aligned_malloc(size, alignment);
+	#if defined(FORGE_MEMORY_HEAP_SIZE_HEADER)
+		// The header is placed right in front of the block, so the block starts one alignment into the allocation.
+		Size offset = alignment > HEADER_SIZE ? alignment : HEADER_SIZE;
+
+		Byte* base = reinterpret_cast<Byte*>(AllocateBlock(offset + size, offset));
+
+		if (!base) {
+			return nullptr;
+		}
+
+		SizeHeader* header = reinterpret_cast<SizeHeader*>(base + offset - HEADER_SIZE);
+		header->m_size = size;
+		header->m_offset = offset;
+
+		return base + offset;
+	#else
+		return AllocateBlock(size, alignment);
+	#endif
 	}
-	VoidPtr HeapAllocationPolicy::Callocate(Size size, Byte value, Size alignment)
+	FORGE_FORCE_INLINE VoidPtr HeapAllocationPolicy::Callocate(Size size, Byte value, Size alignment)
 	{
-		VoidPtr address = _aligned_malloc(size, alignment);
+		VoidPtr address = this->Allocate(size, alignment);
 
-		MemorySet(address, value, size);
+		if (address) {
+			MemorySet(address, value, size);
+		}
 
 		return address;
 	}
-	VoidPtr HeapAllocationPolicy::Reallocate(VoidPtr address, Size size, Size alignment)
+	FORGE_FORCE_INLINE AllocationResult HeapAllocationPolicy::AllocateAtLeast(Size size, Size alignment)
 	{
-		return _aligned_realloc(address, size, alignment);
+	#if defined(FORGE_MEMORY_HEAP_SIZE_HEADER)
+		Size offset = alignment > HEADER_SIZE ? alignment : HEADER_SIZE;
+
+		Byte* base = reinterpret_cast<Byte*>(AllocateBlock(offset + size, offset));
+
+		if (!base) {
+			return AllocationResult{ nullptr, 0 };
+		}
+
+		Size usable_size = GetUsableSize(base);
+
+		SizeHeader* header = reinterpret_cast<SizeHeader*>(base + offset - HEADER_SIZE);
+		header->m_size = usable_size > offset + size ? usable_size - offset : size;
+		header->m_offset = offset;
+
+		return AllocationResult{ base + offset, header->m_size };
+	#else
+		VoidPtr address = AllocateBlock(size, alignment);
+
+		if (!address) {
+			return AllocationResult{ nullptr, 0 };
+		}
+
+		Size usable_size = GetUsableSize(address);
+
+		return AllocationResult{ address, usable_size > size ? usable_size : size };
+	#endif
 	}
+	FORGE_FORCE_INLINE VoidPtr HeapAllocationPolicy::Reallocate(VoidPtr address, Size size, Size alignment)
+	{
+		if (!address) {
+			return this->Allocate(size, alignment);
+		}
 
-	Void HeapAllocationPolicy::Deallocate(VoidPtr address)
+	#if defined(FORGE_MEMORY_HEAP_SIZE_HEADER)
+		SizeHeader* header = reinterpret_cast<SizeHeader*>(reinterpret_cast<Byte*>(address) - HEADER_SIZE);
+
+		Size offset = alignment > HEADER_SIZE ? alignment : HEADER_SIZE;
+		Size old_size = header->m_size;
+
+		// The block keeps its place in the allocation, so its alignment only holds if the offset stays the same.
+		if (header->m_offset == offset) {
+			Byte* base = reinterpret_cast<Byte*>(ReallocateBlock(reinterpret_cast<Byte*>(address) - offset, offset + size, offset));
+
+			if (!base) {
+				return nullptr;
+			}
+
+			header = reinterpret_cast<SizeHeader*>(base + offset - HEADER_SIZE);
+			header->m_size = size;
+
+			return base + offset;
+		}
+
+		VoidPtr new_address = this->Allocate(size, alignment);
+
+		if (new_address) {
+			MemoryCopy(new_address, address, old_size < size ? old_size : size);
+
+			this->Deallocate(address);
+		}
+
+		return new_address;
+	#else
+		return ReallocateBlock(address, size, alignment);
+	#endif
+	}
+
+	FORGE_FORCE_INLINE Void HeapAllocationPolicy::Deallocate(VoidPtr address)
 	{
-		_aligned_free(address);
+	#if defined(FORGE_MEMORY_HEAP_SIZE_HEADER)
+		if (!address) {
+			return;
+		}
+
+		SizeHeader* header = reinterpret_cast<SizeHeader*>(reinterpret_cast<Byte*>(address) - HEADER_SIZE);
+
+		DeallocateBlock(reinterpret_cast<Byte*>(address) - header->m_offset);
+	#else
+		DeallocateBlock(address);
+	#endif
 	}
+	FORGE_FORCE_INLINE Void HeapAllocationPolicy::DeallocateSized(VoidPtr address, Size size, Size alignment)
+	{
+	#if defined(FORGE_MEMORY_HEAP_SIZE_HEADER)
+		if (!address) {
+			return;
+		}
 
-	Void HeapAllocationPolicy::Reset()
+		// Allocate and Reallocate always place the block this far into the allocation.
+		Size offset = alignment > HEADER_SIZE ? alignment : HEADER_SIZE;
+
+		DeallocateBlock(reinterpret_cast<Byte*>(address) - offset);
+	#else
+		DeallocateBlock(address);
+	#endif
+	}
+	FORGE_FORCE_INLINE Size HeapAllocationPolicy::GetAllocatedSize(VoidPtr address)
+	{
+		if (!address) {
+			return 0;
+		}
+
+	#if defined(FORGE_MEMORY_HEAP_SIZE_HEADER)
+		return reinterpret_cast<SizeHeader*>(reinterpret_cast<Byte*>(address) - HEADER_SIZE)->m_size;
+	#else
+		return GetUsableSize(address);
+	#endif
+	}
+
+	FORGE_FORCE_INLINE Void HeapAllocationPolicy::Reset()
 	{
 		// Do Nothing
 	}
+
+	FORGE_FORCE_INLINE VoidPtr HeapAllocationPolicy::AllocateBlock(Size size, Size alignment)
+	{
+	#if defined(_WIN32)
+		return _aligned_malloc(size, alignment);
+	#else
+		// malloc already satisfies the fundamental alignment and is cheaper than posix_memalign.
+		if (alignment <= alignof(max_align_t)) {
+			return malloc(size);
+		}
+
+		VoidPtr address = nullptr;
+
+		if (posix_memalign(&address, alignment, size) != 0) {
+			return nullptr;
+		}
+
+		return address;
+	#endif
+	}
+	FORGE_FORCE_INLINE VoidPtr HeapAllocationPolicy::ReallocateBlock(VoidPtr address, Size size, Size alignment)
+	{
+	#if defined(_WIN32)
+		return _aligned_realloc(address, size, alignment);
+	#else
+		Size usable_size = GetUsableSize(address);
+
+		// The block can only stay where it is if it already satisfies the requested alignment.
+		Bool is_aligned = (reinterpret_cast<Size>(address) & (alignment - 1)) == 0;
+
+		// The block already has room for the new size, only give it back to the heap if it shrinks by more than half.
+		if (is_aligned && size <= usable_size && size >= usable_size / 2) {
+			return address;
+		}
+
+		// realloc grows and shrinks in place whenever the heap can, but only guarantees the fundamental alignment.
+		if (alignment <= alignof(max_align_t)) {
+			return realloc(address, size);
+		}
+
+		if (is_aligned && size <= usable_size) {
+			return address;
+		}
+
+		VoidPtr new_address = AllocateBlock(size, alignment);
+
+		if (new_address) {
+			MemoryCopy(new_address, address, size < usable_size ? size : usable_size);
+
+			free(address);
+		}
+
+		return new_address;
+	#endif
+	}
+	FORGE_FORCE_INLINE Void HeapAllocationPolicy::DeallocateBlock(VoidPtr address)
+	{
+	#if defined(_WIN32)
+		_aligned_free(address);
+	#else
+		free(address);
+	#endif
+	}
+	FORGE_FORCE_INLINE Size HeapAllocationPolicy::GetUsableSize(VoidPtr address)
+	{
+	#if defined(_WIN32)
+		// _aligned_msize needs the alignment the block was allocated with, which is not known here.
+		return 0;
+	#elif defined(__APPLE__)
+		return malloc_size(address);
+	#else
+		return malloc_usable_size(address);
+	#endif
+	}
 }
 
-#endif
\ No newline at end of file
+#endif
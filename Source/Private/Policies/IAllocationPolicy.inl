@@ -0,0 +1,100 @@
+#ifndef IALLOCATION_POLICY_INL_HPP
+#define IALLOCATION_POLICY_INL_HPP
+
+#include <forge-memory/MemoryUtilities.hpp>
+#include <forge-memory/Policies/IAllocationPolicy.hpp>
+
+namespace Forge
+{
+	template<typename InPolicy>
+	FORGE_FORCE_INLINE VoidPtr IAllocationPolicy<InPolicy>::Callocate(Size size, Byte value, Size alignment)
+	{
+		VoidPtr address = static_cast<InPolicy*>(this)->Allocate(size, alignment);
+
+		if (address) {
+			MemorySet(address, value, size);
+		}
+
+		return address;
+	}
+	template<typename InPolicy>
+	FORGE_FORCE_INLINE AllocationResult IAllocationPolicy<InPolicy>::AllocateAtLeast(Size size, Size alignment)
+	{
+		VoidPtr address = static_cast<InPolicy*>(this)->Allocate(size, alignment);
+
+		if (!address) {
+			return AllocationResult{ nullptr, 0 };
+		}
+
+		Size allocated_size = static_cast<InPolicy*>(this)->GetAllocatedSize(address);
+
+		return AllocationResult{ address, allocated_size > size ? allocated_size : size };
+	}
+	template<typename InPolicy>
+	FORGE_FORCE_INLINE Size IAllocationPolicy<InPolicy>::AllocateBatch(Size size, Size alignment, Size count, VoidPtr* addresses)
+	{
+		for (Size i = 0; i < count; i++) {
+			addresses[i] = static_cast<InPolicy*>(this)->Allocate(size, alignment);
+
+			if (!addresses[i]) {
+				return i;
+			}
+		}
+
+		return count;
+	}
+	template<typename InPolicy>
+	FORGE_FORCE_INLINE Void IAllocationPolicy<InPolicy>::DeallocateBatch(VoidPtr* addresses, Size count)
+	{
+		for (Size i = 0; i < count; i++) {
+			static_cast<InPolicy*>(this)->Deallocate(addresses[i]);
+		}
+	}
+	template<typename InPolicy>
+	FORGE_FORCE_INLINE Void IAllocationPolicy<InPolicy>::DeallocateSized(VoidPtr address, Size size, Size alignment)
+	{
+		static_cast<InPolicy*>(this)->Deallocate(address);
+	}
+	template<typename InPolicy>
+	FORGE_FORCE_INLINE Size IAllocationPolicy<InPolicy>::GetAllocatedSize(VoidPtr address)
+	{
+		return 0;
+	}
+	template<typename InPolicy>
+	FORGE_FORCE_INLINE Size IAllocationPolicy<InPolicy>::GetRoundedSize(VoidPtr address, Size size, Size alignment)
+	{
+		return static_cast<InPolicy*>(this)->GetAllocatedSize(address);
+	}
+	template<typename InPolicy>
+	FORGE_FORCE_INLINE Bool IAllocationPolicy<InPolicy>::IsHugePageBacked() const
+	{
+		return false;
+	}
+
+	template<typename InSource, typename InDestination>
+	FORGE_FORCE_INLINE VoidPtr ReallocateAcross(InSource& source, InDestination& destination, VoidPtr address, Size size, Size alignment, Size min_old_size)
+	{
+		Size allocated_size = source.GetAllocatedSize(address);
+
+		// Without a tracked size only the known minimum can be copied, which would silently lose data if it is smaller than the new size.
+		if (!allocated_size && min_old_size < size) {
+			return nullptr;
+		}
+
+		Size old_size = allocated_size > min_old_size ? allocated_size : min_old_size;
+
+		VoidPtr new_address = destination.Allocate(size, alignment);
+
+		if (!new_address) {
+			return nullptr;
+		}
+
+		MemoryCopy(new_address, address, old_size < size ? old_size : size);
+
+		source.Deallocate(address);
+
+		return new_address;
+	}
+}
+
+#endif
@@ -0,0 +1,143 @@
+#ifndef LINEAR_ALLOCATION_POLICY_INL_HPP
+#define LINEAR_ALLOCATION_POLICY_INL_HPP
+
+#include <stdlib.h>
+
+#include <forge-memory/MemoryUtilities.hpp>
+#include <forge-memory/Policies/LinearAllocationPolicy.hpp>
+
+namespace Forge
+{
+	FORGE_FORCE_INLINE LinearAllocationPolicy::LinearAllocationPolicy()
+		: m_start(nullptr), m_offset(0), m_capacity(0), m_last_address(nullptr) {}
+
+	FORGE_FORCE_INLINE Void LinearAllocationPolicy::Initialize(Size capacity)
+	{
+		m_start = reinterpret_cast<Byte*>(malloc(capacity));
+		m_offset = 0;
+		m_capacity = m_start ? capacity : 0;
+		m_last_address = nullptr;
+	}
+	FORGE_FORCE_INLINE Void LinearAllocationPolicy::Deinitialize()
+	{
+		free(m_start);
+
+		m_start = nullptr;
+		m_offset = 0;
+		m_capacity = 0;
+		m_last_address = nullptr;
+	}
+
+	FORGE_FORCE_INLINE VoidPtr LinearAllocationPolicy::Allocate(Size size, Size alignment)
+	{
+		Byte* current = m_start + m_offset;
+		Byte* aligned = reinterpret_cast<Byte*>(MemoryAlignForward(current, alignment));
+
+		Size padding = static_cast<Size>(aligned - current);
+
+		if (padding + size > m_capacity - m_offset) {
+			return nullptr;
+		}
+
+		m_offset += padding + size;
+		m_last_address = aligned;
+
+		return aligned;
+	}
+	FORGE_FORCE_INLINE VoidPtr LinearAllocationPolicy::Callocate(Size size, Byte value, Size alignment)
+	{
+		VoidPtr address = this->Allocate(size, alignment);
+
+		if (address) {
+			MemorySet(address, value, size);
+		}
+
+		return address;
+	}
+	FORGE_FORCE_INLINE VoidPtr LinearAllocationPolicy::Reallocate(VoidPtr address, Size size, Size alignment)
+	{
+		if (!address) {
+			return this->Allocate(size, alignment);
+		}
+
+		Size offset = static_cast<Size>(reinterpret_cast<Byte*>(address) - m_start);
+
+		if (address == m_last_address && (reinterpret_cast<Size>(address) & (alignment - 1)) == 0) {
+			if (size > m_capacity - offset) {
+				return nullptr;
+			}
+
+			m_offset = offset + size;
+
+			return address;
+		}
+
+		VoidPtr new_address = this->Allocate(size, alignment);
+
+		if (new_address) {
+			// Blocks are laid out contiguously, so the old block never extends past the previous bump offset.
+			Size old_size = static_cast<Size>(reinterpret_cast<Byte*>(new_address) - reinterpret_cast<Byte*>(address));
+
+			MemoryCopy(new_address, address, old_size < size ? old_size : size);
+		}
+
+		return new_address;
+	}
+	FORGE_FORCE_INLINE Size LinearAllocationPolicy::AllocateBatch(Size size, Size alignment, Size count, VoidPtr* addresses)
+	{
+		if (!count) {
+			return 0;
+		}
+
+		Byte* current = m_start + m_offset;
+		Byte* aligned = reinterpret_cast<Byte*>(MemoryAlignForward(current, alignment));
+
+		Size padding = static_cast<Size>(aligned - current);
+
+		if (padding + size > m_capacity - m_offset) {
+			return 0;
+		}
+
+		// Every following block starts at the next aligned offset after the previous one.
+		Size stride = (size + alignment - 1) & ~(alignment - 1);
+		Size num_of_blocks = stride ? (m_capacity - m_offset - padding - size) / stride + 1 : count;
+
+		if (num_of_blocks > count) {
+			num_of_blocks = count;
+		}
+
+		for (Size i = 0; i < num_of_blocks; i++) {
+			addresses[i] = aligned + i * stride;
+		}
+
+		m_offset += padding + (num_of_blocks - 1) * stride + size;
+		m_last_address = aligned + (num_of_blocks - 1) * stride;
+
+		return num_of_blocks;
+	}
+
+	FORGE_FORCE_INLINE Void LinearAllocationPolicy::Deallocate(VoidPtr address)
+	{
+		// Do Nothing
+	}
+	FORGE_FORCE_INLINE Size LinearAllocationPolicy::GetAllocatedSize(VoidPtr address)
+	{
+		if (!address || address != m_last_address) {
+			return 0;
+		}
+
+		return static_cast<Size>(m_start + m_offset - reinterpret_cast<Byte*>(address));
+	}
+	FORGE_FORCE_INLINE Bool LinearAllocationPolicy::Owns(VoidPtr address)
+	{
+		return static_cast<Size>(reinterpret_cast<Byte*>(address) - m_start) < m_capacity;
+	}
+
+	FORGE_FORCE_INLINE Void LinearAllocationPolicy::Reset()
+	{
+		m_offset = 0;
+		m_last_address = nullptr;
+	}
+}
+
+#endif
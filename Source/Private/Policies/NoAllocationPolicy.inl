@@ -8,34 +8,50 @@
 
 namespace Forge
 {
-	Void NoAllocationPolicy::Initialize(Size capacity)
+	FORGE_FORCE_INLINE Void NoAllocationPolicy::Initialize(Size capacity)
 	{
 		// Do Nothing
 	}
-	Void NoAllocationPolicy::Deinitialize()
+	FORGE_FORCE_INLINE Void NoAllocationPolicy::Deinitialize()
 	{
 		// Do Nothing
 	}
 
-	VoidPtr NoAllocationPolicy::Allocate(Size size, Size alignment)
+	FORGE_FORCE_INLINE VoidPtr NoAllocationPolicy::Allocate(Size size, Size alignment)
 	{
 		return nullptr;
 	}
-	VoidPtr NoAllocationPolicy::Callocate(Size size, Byte value, Size alignment)
+	FORGE_FORCE_INLINE VoidPtr NoAllocationPolicy::Callocate(Size size, Byte value, Size alignment)
 	{
 	   return nullptr;
 	}
-	VoidPtr NoAllocationPolicy::Reallocate(VoidPtr address, Size size, Size alignment)
+	FORGE_FORCE_INLINE AllocationResult NoAllocationPolicy::AllocateAtLeast(Size size, Size alignment)
+	{
+		return AllocationResult{ nullptr, 0 };
+	}
+	FORGE_FORCE_INLINE VoidPtr NoAllocationPolicy::Reallocate(VoidPtr address, Size size, Size alignment)
 	{
 		return nullptr;
 	}
 
-	Void NoAllocationPolicy::Deallocate(VoidPtr address)
+	FORGE_FORCE_INLINE Void NoAllocationPolicy::Deallocate(VoidPtr address)
+	{
+		// Do Nothing
+	}
+	FORGE_FORCE_INLINE Void NoAllocationPolicy::DeallocateSized(VoidPtr address, Size size, Size alignment)
 	{
 		// Do Nothing
 	}
+	FORGE_FORCE_INLINE Size NoAllocationPolicy::GetAllocatedSize(VoidPtr address)
+	{
+		return 0;
+	}
+	FORGE_FORCE_INLINE Bool NoAllocationPolicy::Owns(VoidPtr address)
+	{
+		return false;
+	}
 
-	Void NoAllocationPolicy::Reset()
+	FORGE_FORCE_INLINE Void NoAllocationPolicy::Reset()
 	{
 		// Do Nothing
 	}
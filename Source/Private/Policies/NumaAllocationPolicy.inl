@@ -0,0 +1,215 @@
+#ifndef NUMA_ALLOCATION_POLICY_INL_HPP
+#define NUMA_ALLOCATION_POLICY_INL_HPP
+
+#include <forge-memory/VirtualMemory.hpp>
+#include <forge-memory/MemoryUtilities.hpp>
+#include <forge-memory/Policies/NumaAllocationPolicy.hpp>
+
+namespace Forge
+{
+	FORGE_FORCE_INLINE NumaAllocationPolicy::NumaAllocationPolicy()
+		: m_start(nullptr), m_capacity(0), m_node_capacity(0), m_num_of_nodes(0), m_node_arenas(nullptr) {}
+
+	FORGE_FORCE_INLINE Size NumaAllocationPolicy::GetNumOfNodes() const
+	{
+		return m_num_of_nodes;
+	}
+	FORGE_FORCE_INLINE Size NumaAllocationPolicy::GetNode(VoidPtr address) const
+	{
+		return static_cast<Size>(reinterpret_cast<Byte*>(address) - m_start) / m_node_capacity;
+	}
+
+	FORGE_FORCE_INLINE Void NumaAllocationPolicy::Initialize(Size capacity)
+	{
+		Size page_size = VirtualGetPageSize();
+		Size num_of_nodes = VirtualGetNumOfNodes();
+
+		if (num_of_nodes > MAX_NUM_OF_NODES) {
+			num_of_nodes = MAX_NUM_OF_NODES;
+		}
+
+		m_node_capacity = (capacity / num_of_nodes + (page_size - 1)) & ~(page_size - 1);
+		m_capacity = m_node_capacity * num_of_nodes;
+		m_start = m_capacity ? reinterpret_cast<Byte*>(VirtualReserve(m_capacity)) : nullptr;
+
+		// Committing is cheap, physical memory is only taken from the bound node once a page is first touched.
+		if (m_start && !VirtualCommit(m_start, m_capacity)) {
+			VirtualRelease(m_start, m_capacity);
+			m_start = nullptr;
+		}
+
+		if (!m_start) {
+			m_capacity = 0;
+			m_node_capacity = 0;
+			m_num_of_nodes = 0;
+			m_node_arenas.reset();
+
+			return;
+		}
+
+		m_num_of_nodes = num_of_nodes;
+		m_node_arenas.reset(new NodeArena[num_of_nodes]);
+
+		for (Size node = 0; node < num_of_nodes; node++) {
+			Byte* node_start = m_start + node * m_node_capacity;
+
+			if (num_of_nodes > 1) {
+				VirtualBindToNode(node_start, m_node_capacity, node);
+			}
+
+			m_node_arenas[node].m_allocation_policy.Initialize(node_start, m_node_capacity);
+		}
+	}
+	FORGE_FORCE_INLINE Void NumaAllocationPolicy::Deinitialize()
+	{
+		for (Size node = 0; node < m_num_of_nodes; node++) {
+			m_node_arenas[node].m_allocation_policy.Deinitialize();
+		}
+
+		if (m_start) {
+			VirtualRelease(m_start, m_capacity);
+		}
+
+		m_start = nullptr;
+		m_capacity = 0;
+		m_node_capacity = 0;
+		m_num_of_nodes = 0;
+		m_node_arenas.reset();
+	}
+
+	FORGE_FORCE_INLINE VoidPtr NumaAllocationPolicy::Allocate(Size size, Size alignment)
+	{
+		if (!m_num_of_nodes) {
+			return nullptr;
+		}
+
+		Size current_node = GetCurrentNode();
+
+		for (Size index = 0; index < m_num_of_nodes; index++) {
+			Size node = current_node + index < m_num_of_nodes ? current_node + index : current_node + index - m_num_of_nodes;
+
+			VoidPtr address = this->Allocate(size, alignment, node);
+
+			if (address) {
+				return address;
+			}
+		}
+
+		return nullptr;
+	}
+	FORGE_FORCE_INLINE VoidPtr NumaAllocationPolicy::Allocate(Size size, Size alignment, Size node)
+	{
+		if (node >= m_num_of_nodes) {
+			return nullptr;
+		}
+
+		NodeArena& node_arena = m_node_arenas[node];
+
+		::std::lock_guard<::std::mutex> lock(node_arena.m_mutex);
+
+		return node_arena.m_allocation_policy.Allocate(size, alignment);
+	}
+	FORGE_FORCE_INLINE VoidPtr NumaAllocationPolicy::Callocate(Size size, Byte value, Size alignment)
+	{
+		VoidPtr address = this->Allocate(size, alignment);
+
+		if (address) {
+			MemorySet(address, value, size);
+		}
+
+		return address;
+	}
+	FORGE_FORCE_INLINE VoidPtr NumaAllocationPolicy::Reallocate(VoidPtr address, Size size, Size alignment)
+	{
+		if (!address) {
+			return this->Allocate(size, alignment);
+		}
+
+		NodeArena& node_arena = m_node_arenas[GetNode(address)];
+
+		Size old_size = 0;
+
+		{
+			::std::lock_guard<::std::mutex> lock(node_arena.m_mutex);
+
+			VoidPtr new_address = node_arena.m_allocation_policy.Reallocate(address, size, alignment);
+
+			if (new_address) {
+				return new_address;
+			}
+
+			old_size = node_arena.m_allocation_policy.GetAllocatedSize(address);
+		}
+
+		// The arena of the node is exhausted, move the memory block to whichever node still has room.
+		VoidPtr new_address = this->Allocate(size, alignment);
+
+		if (new_address) {
+			MemoryCopy(new_address, address, old_size < size ? old_size : size);
+
+			this->Deallocate(address);
+		}
+
+		return new_address;
+	}
+
+	FORGE_FORCE_INLINE Void NumaAllocationPolicy::Deallocate(VoidPtr address)
+	{
+		if (!address) {
+			return;
+		}
+
+		NodeArena& node_arena = m_node_arenas[GetNode(address)];
+
+		::std::lock_guard<::std::mutex> lock(node_arena.m_mutex);
+
+		node_arena.m_allocation_policy.Deallocate(address);
+	}
+	FORGE_FORCE_INLINE Size NumaAllocationPolicy::GetAllocatedSize(VoidPtr address)
+	{
+		if (!address) {
+			return 0;
+		}
+
+		NodeArena& node_arena = m_node_arenas[GetNode(address)];
+
+		// Freeing a neighbouring block rewrites flag bits in the size field of this block.
+		::std::lock_guard<::std::mutex> lock(node_arena.m_mutex);
+
+		return node_arena.m_allocation_policy.GetAllocatedSize(address);
+	}
+	FORGE_FORCE_INLINE Bool NumaAllocationPolicy::Owns(VoidPtr address)
+	{
+		return static_cast<Size>(reinterpret_cast<Byte*>(address) - m_start) < m_capacity;
+	}
+
+	FORGE_FORCE_INLINE Void NumaAllocationPolicy::Reset()
+	{
+		for (Size node = 0; node < m_num_of_nodes; node++) {
+			::std::lock_guard<::std::mutex> lock(m_node_arenas[node].m_mutex);
+
+			m_node_arenas[node].m_allocation_policy.Reset();
+		}
+	}
+
+	FORGE_FORCE_INLINE Size NumaAllocationPolicy::GetCurrentNode()
+	{
+		if (m_num_of_nodes == 1) {
+			return 0;
+		}
+
+		ThreadNode& thread_node = s_thread_node;
+
+		// Threads rarely migrate between nodes, so the node is only queried every so often.
+		if (thread_node.m_countdown == 0) {
+			thread_node.m_node = VirtualGetCurrentNode();
+			thread_node.m_countdown = NODE_REFRESH_INTERVAL;
+		}
+
+		thread_node.m_countdown--;
+
+		return thread_node.m_node < m_num_of_nodes ? thread_node.m_node : 0;
+	}
+}
+
+#endif
@@ -0,0 +1,167 @@
+#ifndef POOL_ALLOCATION_POLICY_INL_HPP
+#define POOL_ALLOCATION_POLICY_INL_HPP
+
+#include <stdlib.h>
+
+#include <forge-memory/MemoryUtilities.hpp>
+#include <forge-memory/Policies/PoolAllocationPolicy.hpp>
+
+namespace Forge
+{
+	template<Size BlockSize, Size BlockAlignment>
+	FORGE_FORCE_INLINE PoolAllocationPolicy<BlockSize, BlockAlignment>::PoolAllocationPolicy()
+		: m_memory(nullptr), m_start(nullptr), m_num_of_blocks(0), m_num_of_touched_blocks(0), m_free_list(nullptr) {}
+
+	template<Size BlockSize, Size BlockAlignment>
+	FORGE_FORCE_INLINE Size PoolAllocationPolicy<BlockSize, BlockAlignment>::GetNumOfBlocks()
+	{
+		return m_num_of_blocks;
+	}
+
+	template<Size BlockSize, Size BlockAlignment>
+	FORGE_FORCE_INLINE Void PoolAllocationPolicy<BlockSize, BlockAlignment>::Initialize(Size capacity)
+	{
+		m_memory = malloc(capacity + BLOCK_ALIGNMENT - 1);
+		m_start = reinterpret_cast<Byte*>(MemoryAlignForward(m_memory, BLOCK_ALIGNMENT));
+		m_num_of_blocks = m_memory ? capacity / BLOCK_STRIDE : 0;
+
+		this->Reset();
+	}
+	template<Size BlockSize, Size BlockAlignment>
+	FORGE_FORCE_INLINE Void PoolAllocationPolicy<BlockSize, BlockAlignment>::Deinitialize()
+	{
+		free(m_memory);
+
+		m_memory = nullptr;
+		m_start = nullptr;
+		m_num_of_blocks = 0;
+
+		this->Reset();
+	}
+
+	template<Size BlockSize, Size BlockAlignment>
+	FORGE_FORCE_INLINE VoidPtr PoolAllocationPolicy<BlockSize, BlockAlignment>::Allocate(Size size, Size alignment)
+	{
+		if (size > BlockSize || alignment > BLOCK_ALIGNMENT) {
+			return nullptr;
+		}
+
+		if (m_free_list) {
+			FreeBlock* block = m_free_list;
+			m_free_list = block->m_next;
+
+			return block;
+		}
+
+		if (m_num_of_touched_blocks < m_num_of_blocks) {
+			return m_start + (m_num_of_touched_blocks++) * BLOCK_STRIDE;
+		}
+
+		return nullptr;
+	}
+	template<Size BlockSize, Size BlockAlignment>
+	FORGE_FORCE_INLINE VoidPtr PoolAllocationPolicy<BlockSize, BlockAlignment>::Callocate(Size size, Byte value, Size alignment)
+	{
+		VoidPtr address = this->Allocate(size, alignment);
+
+		if (address) {
+			MemorySet(address, value, size);
+		}
+
+		return address;
+	}
+	template<Size BlockSize, Size BlockAlignment>
+	FORGE_FORCE_INLINE VoidPtr PoolAllocationPolicy<BlockSize, BlockAlignment>::Reallocate(VoidPtr address, Size size, Size alignment)
+	{
+		if (size > BlockSize || alignment > BLOCK_ALIGNMENT) {
+			return nullptr;
+		}
+
+		if (!address) {
+			return this->Allocate(size, alignment);
+		}
+
+		return address;
+	}
+	template<Size BlockSize, Size BlockAlignment>
+	FORGE_FORCE_INLINE Size PoolAllocationPolicy<BlockSize, BlockAlignment>::AllocateBatch(Size size, Size alignment, Size count, VoidPtr* addresses)
+	{
+		if (size > BlockSize || alignment > BLOCK_ALIGNMENT) {
+			return 0;
+		}
+
+		Size num_of_blocks = 0;
+
+		FreeBlock* block = m_free_list;
+
+		while (block && num_of_blocks < count) {
+			addresses[num_of_blocks++] = block;
+			block = block->m_next;
+		}
+
+		m_free_list = block;
+
+		Size num_of_untouched_blocks = m_num_of_blocks - m_num_of_touched_blocks;
+		Size num_of_bumped_blocks = count - num_of_blocks < num_of_untouched_blocks ? count - num_of_blocks : num_of_untouched_blocks;
+
+		Byte* address = m_start + m_num_of_touched_blocks * BLOCK_STRIDE;
+
+		for (Size i = 0; i < num_of_bumped_blocks; i++) {
+			addresses[num_of_blocks++] = address + i * BLOCK_STRIDE;
+		}
+
+		m_num_of_touched_blocks += num_of_bumped_blocks;
+
+		return num_of_blocks;
+	}
+
+	template<Size BlockSize, Size BlockAlignment>
+	FORGE_FORCE_INLINE Void PoolAllocationPolicy<BlockSize, BlockAlignment>::Deallocate(VoidPtr address)
+	{
+		if (!address) {
+			return;
+		}
+
+		FreeBlock* block = reinterpret_cast<FreeBlock*>(address);
+		block->m_next = m_free_list;
+
+		m_free_list = block;
+	}
+	template<Size BlockSize, Size BlockAlignment>
+	FORGE_FORCE_INLINE Void PoolAllocationPolicy<BlockSize, BlockAlignment>::DeallocateBatch(VoidPtr* addresses, Size count)
+	{
+		FreeBlock* head = m_free_list;
+
+		for (Size i = 0; i < count; i++) {
+			if (!addresses[i]) {
+				continue;
+			}
+
+			FreeBlock* block = reinterpret_cast<FreeBlock*>(addresses[i]);
+			block->m_next = head;
+
+			head = block;
+		}
+
+		m_free_list = head;
+	}
+	template<Size BlockSize, Size BlockAlignment>
+	FORGE_FORCE_INLINE Size PoolAllocationPolicy<BlockSize, BlockAlignment>::GetAllocatedSize(VoidPtr address)
+	{
+		return address ? BlockSize : 0;
+	}
+	template<Size BlockSize, Size BlockAlignment>
+	FORGE_FORCE_INLINE Bool PoolAllocationPolicy<BlockSize, BlockAlignment>::Owns(VoidPtr address)
+	{
+		return static_cast<Size>(reinterpret_cast<Byte*>(address) - m_start) < m_num_of_blocks * BLOCK_STRIDE;
+	}
+
+	template<Size BlockSize, Size BlockAlignment>
+	FORGE_FORCE_INLINE Void PoolAllocationPolicy<BlockSize, BlockAlignment>::Reset()
+	{
+		m_num_of_touched_blocks = 0;
+		m_free_list = nullptr;
+	}
+}
+
+#endif
@@ -0,0 +1,147 @@
+#ifndef SEGREGATOR_ALLOCATION_POLICY_INL_HPP
+#define SEGREGATOR_ALLOCATION_POLICY_INL_HPP
+
+#include <forge-memory/Policies/SegregatorAllocationPolicy.hpp>
+
+namespace Forge
+{
+	template<Size Threshold, typename Small, typename Large>
+	FORGE_FORCE_INLINE Small& SegregatorAllocationPolicy<Threshold, Small, Large>::GetSmall()
+	{
+		return m_small;
+	}
+	template<Size Threshold, typename Small, typename Large>
+	FORGE_FORCE_INLINE Large& SegregatorAllocationPolicy<Threshold, Small, Large>::GetLarge()
+	{
+		return m_large;
+	}
+
+	template<Size Threshold, typename Small, typename Large>
+	FORGE_FORCE_INLINE Void SegregatorAllocationPolicy<Threshold, Small, Large>::Initialize(Size capacity)
+	{
+		m_small.Initialize(capacity);
+		m_large.Initialize(capacity);
+	}
+	template<Size Threshold, typename Small, typename Large>
+	FORGE_FORCE_INLINE Void SegregatorAllocationPolicy<Threshold, Small, Large>::Deinitialize()
+	{
+		m_small.Deinitialize();
+		m_large.Deinitialize();
+	}
+
+	template<Size Threshold, typename Small, typename Large>
+	FORGE_FORCE_INLINE VoidPtr SegregatorAllocationPolicy<Threshold, Small, Large>::Allocate(Size size, Size alignment)
+	{
+		return size <= Threshold ? m_small.Allocate(size, alignment) : m_large.Allocate(size, alignment);
+	}
+	template<Size Threshold, typename Small, typename Large>
+	FORGE_FORCE_INLINE VoidPtr SegregatorAllocationPolicy<Threshold, Small, Large>::Callocate(Size size, Byte value, Size alignment)
+	{
+		return size <= Threshold ? m_small.Callocate(size, value, alignment) : m_large.Callocate(size, value, alignment);
+	}
+	template<Size Threshold, typename Small, typename Large>
+	FORGE_FORCE_INLINE AllocationResult SegregatorAllocationPolicy<Threshold, Small, Large>::AllocateAtLeast(Size size, Size alignment)
+	{
+		if (size > Threshold) {
+			return m_large.AllocateAtLeast(size, alignment);
+		}
+
+		AllocationResult result = m_small.AllocateAtLeast(size, alignment);
+
+		if (result.m_size > Threshold) {
+			result.m_size = Threshold;
+		}
+
+		return result;
+	}
+	template<Size Threshold, typename Small, typename Large>
+	FORGE_FORCE_INLINE VoidPtr SegregatorAllocationPolicy<Threshold, Small, Large>::Reallocate(VoidPtr address, Size size, Size alignment)
+	{
+		if (!address) {
+			return this->Allocate(size, alignment);
+		}
+
+		Bool is_small = IsSmall(address);
+
+		if (is_small && size <= Threshold) {
+			return m_small.Reallocate(address, size, alignment);
+		}
+
+		if (!is_small && size > Threshold) {
+			return m_large.Reallocate(address, size, alignment);
+		}
+
+		// A memory block of the large memory policy is known to be larger than the threshold.
+		return is_small ?
+			ReallocateAcross(m_small, m_large, address, size, alignment, 0) :
+			ReallocateAcross(m_large, m_small, address, size, alignment, Threshold + 1);
+	}
+	template<Size Threshold, typename Small, typename Large>
+	FORGE_FORCE_INLINE Size SegregatorAllocationPolicy<Threshold, Small, Large>::AllocateBatch(Size size, Size alignment, Size count, VoidPtr* addresses)
+	{
+		return size <= Threshold ? m_small.AllocateBatch(size, alignment, count, addresses) : m_large.AllocateBatch(size, alignment, count, addresses);
+	}
+
+	template<Size Threshold, typename Small, typename Large>
+	FORGE_FORCE_INLINE Void SegregatorAllocationPolicy<Threshold, Small, Large>::Deallocate(VoidPtr address)
+	{
+		if (IsSmall(address)) {
+			m_small.Deallocate(address);
+		}
+		else {
+			m_large.Deallocate(address);
+		}
+	}
+	template<Size Threshold, typename Small, typename Large>
+	FORGE_FORCE_INLINE Void SegregatorAllocationPolicy<Threshold, Small, Large>::DeallocateSized(VoidPtr address, Size size, Size alignment)
+	{
+		if (size <= Threshold) {
+			m_small.DeallocateSized(address, size, alignment);
+		}
+		else {
+			m_large.DeallocateSized(address, size, alignment);
+		}
+	}
+	template<Size Threshold, typename Small, typename Large>
+	FORGE_FORCE_INLINE Size SegregatorAllocationPolicy<Threshold, Small, Large>::GetAllocatedSize(VoidPtr address)
+	{
+		return IsSmall(address) ? m_small.GetAllocatedSize(address) : m_large.GetAllocatedSize(address);
+	}
+	template<Size Threshold, typename Small, typename Large>
+	FORGE_FORCE_INLINE Size SegregatorAllocationPolicy<Threshold, Small, Large>::GetRoundedSize(VoidPtr address, Size size, Size alignment)
+	{
+		return size <= Threshold ? m_small.GetRoundedSize(address, size, alignment) : m_large.GetRoundedSize(address, size, alignment);
+	}
+	template<Size Threshold, typename Small, typename Large>
+	template<typename InSmall, typename>
+	FORGE_FORCE_INLINE Bool SegregatorAllocationPolicy<Threshold, Small, Large>::Owns(VoidPtr address)
+	{
+		return m_small.Owns(address) || m_large.Owns(address);
+	}
+
+	template<Size Threshold, typename Small, typename Large>
+	FORGE_FORCE_INLINE Void SegregatorAllocationPolicy<Threshold, Small, Large>::Reset()
+	{
+		m_small.Reset();
+		m_large.Reset();
+	}
+
+	template<Size Threshold, typename Small, typename Large>
+	FORGE_FORCE_INLINE Bool SegregatorAllocationPolicy<Threshold, Small, Large>::IsHugePageBacked() const
+	{
+		return m_small.IsHugePageBacked() && m_large.IsHugePageBacked();
+	}
+
+	template<Size Threshold, typename Small, typename Large>
+	FORGE_FORCE_INLINE Bool SegregatorAllocationPolicy<Threshold, Small, Large>::IsSmall(VoidPtr address)
+	{
+		if constexpr (IsOwningAllocationPolicy<Small>::value) {
+			return m_small.Owns(address);
+		}
+		else {
+			return !m_large.Owns(address);
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,310 @@
+#ifndef SIZE_CLASS_ALLOCATION_POLICY_INL_HPP
+#define SIZE_CLASS_ALLOCATION_POLICY_INL_HPP
+
+#include <forge-memory/BitUtilities.hpp>
+#include <forge-memory/MemoryUtilities.hpp>
+#include <forge-memory/Policies/SizeClassAllocationPolicy.hpp>
+
+namespace Forge
+{
+	template<Size MaxSize, typename BackingPolicy>
+	FORGE_FORCE_INLINE SizeClassAllocationPolicy<MaxSize, BackingPolicy>::SizeClassAllocationPolicy()
+		: m_size_classes(), m_slabs(nullptr), m_large_blocks(nullptr) {}
+
+	template<Size MaxSize, typename BackingPolicy>
+	FORGE_FORCE_INLINE Size SizeClassAllocationPolicy<MaxSize, BackingPolicy>::GetAllocatedSize(VoidPtr address)
+	{
+		return address ? GetSlab(address)->m_block_size : 0;
+	}
+	template<Size MaxSize, typename BackingPolicy>
+	FORGE_FORCE_INLINE Size SizeClassAllocationPolicy<MaxSize, BackingPolicy>::GetRoundedSize(VoidPtr address, Size size, Size alignment)
+	{
+		if (!address) {
+			return 0;
+		}
+
+		Size class_index = GetClassIndex(size, alignment);
+
+		return class_index < NUM_OF_SIZE_CLASSES ? SIZE_CLASSES[class_index] : size;
+	}
+
+	template<Size MaxSize, typename BackingPolicy>
+	FORGE_FORCE_INLINE Void SizeClassAllocationPolicy<MaxSize, BackingPolicy>::Initialize(Size capacity)
+	{
+		m_backing_policy.Initialize(capacity);
+
+		for (SizeClass& size_class : m_size_classes) {
+			size_class = SizeClass{ nullptr, nullptr, nullptr };
+		}
+
+		m_slabs = nullptr;
+		m_large_blocks = nullptr;
+	}
+	template<Size MaxSize, typename BackingPolicy>
+	FORGE_FORCE_INLINE Void SizeClassAllocationPolicy<MaxSize, BackingPolicy>::Deinitialize()
+	{
+		this->Reset();
+
+		m_backing_policy.Deinitialize();
+	}
+
+	template<Size MaxSize, typename BackingPolicy>
+	FORGE_FORCE_INLINE VoidPtr SizeClassAllocationPolicy<MaxSize, BackingPolicy>::Allocate(Size size, Size alignment)
+	{
+		Size class_index = GetClassIndex(size, alignment);
+
+		if (class_index < NUM_OF_SIZE_CLASSES) {
+			SizeClass& size_class = m_size_classes[class_index];
+
+			if (size_class.m_free_list) {
+				FreeBlock* block = size_class.m_free_list;
+				size_class.m_free_list = block->m_next;
+
+				return block;
+			}
+
+			if (size_class.m_current == size_class.m_end && !RefillSizeClass(class_index)) {
+				return nullptr;
+			}
+
+			Byte* block = size_class.m_current;
+			size_class.m_current += SIZE_CLASSES[class_index];
+
+			return block;
+		}
+
+		Size offset = alignment < HEADER_SIZE ? HEADER_SIZE : alignment;
+
+		if (offset >= SLAB_SIZE) {
+			return nullptr;
+		}
+
+		Slab* slab = reinterpret_cast<Slab*>(m_backing_policy.Allocate(offset + size, SLAB_SIZE));
+
+		if (!slab) {
+			return nullptr;
+		}
+
+		slab->m_next = m_large_blocks;
+		slab->m_previous = nullptr;
+		slab->m_class_index = LARGE_CLASS;
+		slab->m_block_size = size;
+
+		if (m_large_blocks) {
+			m_large_blocks->m_previous = slab;
+		}
+
+		m_large_blocks = slab;
+
+		return reinterpret_cast<Byte*>(slab) + offset;
+	}
+	template<Size MaxSize, typename BackingPolicy>
+	FORGE_FORCE_INLINE VoidPtr SizeClassAllocationPolicy<MaxSize, BackingPolicy>::Callocate(Size size, Byte value, Size alignment)
+	{
+		VoidPtr address = this->Allocate(size, alignment);
+
+		if (address) {
+			MemorySet(address, value, size);
+		}
+
+		return address;
+	}
+	template<Size MaxSize, typename BackingPolicy>
+	FORGE_FORCE_INLINE VoidPtr SizeClassAllocationPolicy<MaxSize, BackingPolicy>::Reallocate(VoidPtr address, Size size, Size alignment)
+	{
+		if (!address) {
+			return this->Allocate(size, alignment);
+		}
+
+		Slab* slab = GetSlab(address);
+		Size old_size = slab->m_block_size;
+
+		// Staying in the same size class keeps the block reachable by a sized deallocation with the new size.
+		if (slab->m_class_index != LARGE_CLASS && GetClassIndex(size, alignment) == slab->m_class_index) {
+			return address;
+		}
+
+		VoidPtr new_address = this->Allocate(size, alignment);
+
+		if (new_address) {
+			MemoryCopy(new_address, address, old_size < size ? old_size : size);
+
+			this->Deallocate(address);
+		}
+
+		return new_address;
+	}
+	template<Size MaxSize, typename BackingPolicy>
+	FORGE_FORCE_INLINE Size SizeClassAllocationPolicy<MaxSize, BackingPolicy>::AllocateBatch(Size size, Size alignment, Size count, VoidPtr* addresses)
+	{
+		Size class_index = GetClassIndex(size, alignment);
+
+		// Large blocks each need their own allocation from the backing policy anyway.
+		if (class_index == NUM_OF_SIZE_CLASSES) {
+			return IAllocationPolicy<SizeClassAllocationPolicy<MaxSize, BackingPolicy>>::AllocateBatch(size, alignment, count, addresses);
+		}
+
+		SizeClass& size_class = m_size_classes[class_index];
+		Size block_size = SIZE_CLASSES[class_index];
+
+		Size num_of_blocks = 0;
+
+		FreeBlock* block = size_class.m_free_list;
+
+		while (block && num_of_blocks < count) {
+			addresses[num_of_blocks++] = block;
+			block = block->m_next;
+		}
+
+		size_class.m_free_list = block;
+
+		while (num_of_blocks < count) {
+			if (size_class.m_current == size_class.m_end && !RefillSizeClass(class_index)) {
+				break;
+			}
+
+			Size num_of_slab_blocks = static_cast<Size>(size_class.m_end - size_class.m_current) / block_size;
+
+			if (num_of_slab_blocks > count - num_of_blocks) {
+				num_of_slab_blocks = count - num_of_blocks;
+			}
+
+			for (Size i = 0; i < num_of_slab_blocks; i++) {
+				addresses[num_of_blocks++] = size_class.m_current + i * block_size;
+			}
+
+			size_class.m_current += num_of_slab_blocks * block_size;
+		}
+
+		return num_of_blocks;
+	}
+
+	template<Size MaxSize, typename BackingPolicy>
+	FORGE_FORCE_INLINE Void SizeClassAllocationPolicy<MaxSize, BackingPolicy>::Deallocate(VoidPtr address)
+	{
+		if (!address) {
+			return;
+		}
+
+		Slab* slab = GetSlab(address);
+
+		if (slab->m_class_index == LARGE_CLASS) {
+			if (slab->m_previous) {
+				slab->m_previous->m_next = slab->m_next;
+			}
+			else {
+				m_large_blocks = slab->m_next;
+			}
+
+			if (slab->m_next) {
+				slab->m_next->m_previous = slab->m_previous;
+			}
+
+			m_backing_policy.Deallocate(slab);
+
+			return;
+		}
+
+		SizeClass& size_class = m_size_classes[slab->m_class_index];
+
+		FreeBlock* block = reinterpret_cast<FreeBlock*>(address);
+		block->m_next = size_class.m_free_list;
+
+		size_class.m_free_list = block;
+	}
+	template<Size MaxSize, typename BackingPolicy>
+	FORGE_FORCE_INLINE Void SizeClassAllocationPolicy<MaxSize, BackingPolicy>::DeallocateSized(VoidPtr address, Size size, Size alignment)
+	{
+		Size class_index = GetClassIndex(size, alignment);
+
+		if (!address || class_index == NUM_OF_SIZE_CLASSES) {
+			this->Deallocate(address);
+
+			return;
+		}
+
+		SizeClass& size_class = m_size_classes[class_index];
+
+		FreeBlock* block = reinterpret_cast<FreeBlock*>(address);
+		block->m_next = size_class.m_free_list;
+
+		size_class.m_free_list = block;
+	}
+
+	template<Size MaxSize, typename BackingPolicy>
+	FORGE_FORCE_INLINE Void SizeClassAllocationPolicy<MaxSize, BackingPolicy>::Reset()
+	{
+		for (Slab* list : { m_slabs, m_large_blocks }) {
+			while (list) {
+				Slab* next = list->m_next;
+				m_backing_policy.Deallocate(list);
+				list = next;
+			}
+		}
+
+		for (SizeClass& size_class : m_size_classes) {
+			size_class = SizeClass{ nullptr, nullptr, nullptr };
+		}
+
+		m_slabs = nullptr;
+		m_large_blocks = nullptr;
+
+		m_backing_policy.Reset();
+	}
+
+	template<Size MaxSize, typename BackingPolicy>
+	FORGE_FORCE_INLINE typename SizeClassAllocationPolicy<MaxSize, BackingPolicy>::Slab*
+		SizeClassAllocationPolicy<MaxSize, BackingPolicy>::GetSlab(VoidPtr address)
+	{
+		return reinterpret_cast<Slab*>(reinterpret_cast<Size>(address) & ~(SLAB_SIZE - 1));
+	}
+	template<Size MaxSize, typename BackingPolicy>
+	FORGE_FORCE_INLINE Size SizeClassAllocationPolicy<MaxSize, BackingPolicy>::GetClassIndex(Size size, Size alignment)
+	{
+		if (size > SIZE_CLASSES[NUM_OF_SIZE_CLASSES - 1]) {
+			return NUM_OF_SIZE_CLASSES;
+		}
+
+		Size class_index = SizeClassTable<MaxSize>::GetSizeClassIndex(size);
+
+		// Blocks of a size class are aligned to the lowest set bit of the class size, capped by the header size.
+		while (class_index < NUM_OF_SIZE_CLASSES) {
+			Size block_size = SIZE_CLASSES[class_index];
+			Size block_alignment = block_size & (~block_size + 1);
+
+			if (alignment <= block_alignment && alignment <= HEADER_SIZE) {
+				break;
+			}
+
+			class_index++;
+		}
+
+		return class_index;
+	}
+	template<Size MaxSize, typename BackingPolicy>
+	FORGE_FORCE_INLINE Bool SizeClassAllocationPolicy<MaxSize, BackingPolicy>::RefillSizeClass(Size class_index)
+	{
+		Slab* slab = reinterpret_cast<Slab*>(m_backing_policy.Allocate(SLAB_SIZE, SLAB_SIZE));
+
+		if (!slab) {
+			return false;
+		}
+
+		Size block_size = SIZE_CLASSES[class_index];
+
+		slab->m_next = m_slabs;
+		slab->m_previous = nullptr;
+		slab->m_class_index = class_index;
+		slab->m_block_size = block_size;
+
+		m_slabs = slab;
+
+		SizeClass& size_class = m_size_classes[class_index];
+		size_class.m_current = reinterpret_cast<Byte*>(slab) + HEADER_SIZE;
+		size_class.m_end = size_class.m_current + ((SLAB_SIZE - HEADER_SIZE) / block_size) * block_size;
+
+		return true;
+	}
+}
+
+#endif
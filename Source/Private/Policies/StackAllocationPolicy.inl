@@ -0,0 +1,209 @@
+#ifndef STACK_ALLOCATION_POLICY_INL_HPP
+#define STACK_ALLOCATION_POLICY_INL_HPP
+
+#include <stdlib.h>
+
+#include <forge-memory/MemoryUtilities.hpp>
+#include <forge-memory/Policies/StackAllocationPolicy.hpp>
+
+namespace Forge
+{
+	FORGE_FORCE_INLINE StackAllocationPolicy::StackAllocationPolicy()
+		: m_start(nullptr), m_capacity(0),
+		  m_bottom(0), m_top(0), m_bottom_last(nullptr), m_top_last(nullptr),
+		  m_allocation_end(StackEnd::Bottom) {}
+
+	FORGE_FORCE_INLINE Void StackAllocationPolicy::SetAllocationEnd(StackEnd end)
+	{
+		m_allocation_end = end;
+	}
+	FORGE_FORCE_INLINE StackEnd StackAllocationPolicy::GetAllocationEnd()
+	{
+		return m_allocation_end;
+	}
+
+	FORGE_FORCE_INLINE StackAllocationPolicy::Marker StackAllocationPolicy::GetMarker()
+	{
+		return Marker{ m_bottom, m_top, m_bottom_last, m_top_last };
+	}
+	FORGE_FORCE_INLINE Void StackAllocationPolicy::FreeToMarker(const Marker& marker)
+	{
+		m_bottom = marker.m_bottom;
+		m_top = marker.m_top;
+		m_bottom_last = marker.m_bottom_last;
+		m_top_last = marker.m_top_last;
+	}
+
+	FORGE_FORCE_INLINE Void StackAllocationPolicy::Initialize(Size capacity)
+	{
+		m_start = reinterpret_cast<Byte*>(malloc(capacity));
+		m_capacity = m_start ? capacity : 0;
+
+		this->Reset();
+	}
+	FORGE_FORCE_INLINE Void StackAllocationPolicy::Deinitialize()
+	{
+		free(m_start);
+
+		m_start = nullptr;
+		m_capacity = 0;
+
+		this->Reset();
+	}
+
+	FORGE_FORCE_INLINE VoidPtr StackAllocationPolicy::Allocate(Size size, Size alignment)
+	{
+		return this->Allocate(size, alignment, m_allocation_end);
+	}
+	FORGE_FORCE_INLINE VoidPtr StackAllocationPolicy::Allocate(Size size, Size alignment, StackEnd end)
+	{
+		if (alignment < alignof(Header)) {
+			alignment = alignof(Header);
+		}
+
+		Size start = reinterpret_cast<Size>(m_start);
+
+		if (end == StackEnd::Bottom) {
+			Size address = (start + m_bottom + sizeof(Header) + (alignment - 1)) & ~(alignment - 1);
+
+			if (address - start > m_top || size > m_top - (address - start)) {
+				return nullptr;
+			}
+
+			Header* header = reinterpret_cast<Header*>(address - sizeof(Header));
+			header->m_previous_offset = m_bottom;
+			header->m_previous_last = m_bottom_last;
+
+			m_bottom = address - start + size;
+			m_bottom_last = reinterpret_cast<Byte*>(address);
+
+			return m_bottom_last;
+		}
+
+		if (size > m_top) {
+			return nullptr;
+		}
+
+		Size address = (start + m_top - size) & ~(alignment - 1);
+
+		if (address < start + m_bottom + sizeof(Header)) {
+			return nullptr;
+		}
+
+		Header* header = reinterpret_cast<Header*>(address - sizeof(Header));
+		header->m_previous_offset = m_top;
+		header->m_previous_last = m_top_last;
+
+		m_top = address - start - sizeof(Header);
+		m_top_last = reinterpret_cast<Byte*>(address);
+
+		return m_top_last;
+	}
+	FORGE_FORCE_INLINE VoidPtr StackAllocationPolicy::Callocate(Size size, Byte value, Size alignment)
+	{
+		VoidPtr address = this->Allocate(size, alignment);
+
+		if (address) {
+			MemorySet(address, value, size);
+		}
+
+		return address;
+	}
+	FORGE_FORCE_INLINE VoidPtr StackAllocationPolicy::Reallocate(VoidPtr address, Size size, Size alignment)
+	{
+		if (!address) {
+			return this->Allocate(size, alignment);
+		}
+
+		Byte* block = reinterpret_cast<Byte*>(address);
+		Bool is_aligned = (reinterpret_cast<Size>(address) & (alignment - 1)) == 0;
+
+		StackEnd end = block < m_start + m_bottom ? StackEnd::Bottom : StackEnd::Top;
+
+		// The old block never extends past the end of its own half of the stack.
+		Size old_size = 0;
+
+		if (end == StackEnd::Bottom) {
+			old_size = static_cast<Size>(m_start + m_bottom - block);
+
+			if (block == m_bottom_last && is_aligned && size <= static_cast<Size>(m_start + m_top - block)) {
+				m_bottom = static_cast<Size>(block - m_start) + size;
+				return address;
+			}
+		}
+		else {
+			old_size = static_cast<Size>(m_start + m_capacity - block);
+
+			if (block == m_top_last) {
+				Header* header = reinterpret_cast<Header*>(block - sizeof(Header));
+				old_size = static_cast<Size>(m_start + header->m_previous_offset - block);
+
+				if (is_aligned && size <= old_size) {
+					return address;
+				}
+			}
+		}
+
+		VoidPtr new_address = this->Allocate(size, alignment, end);
+
+		if (new_address) {
+			MemoryCopy(new_address, address, old_size < size ? old_size : size);
+		}
+
+		return new_address;
+	}
+
+	FORGE_FORCE_INLINE Void StackAllocationPolicy::Deallocate(VoidPtr address)
+	{
+		Byte* block = reinterpret_cast<Byte*>(address);
+
+		if (!block) {
+			return;
+		}
+
+		Header* header = reinterpret_cast<Header*>(block - sizeof(Header));
+
+		if (block == m_bottom_last) {
+			m_bottom = header->m_previous_offset;
+			m_bottom_last = header->m_previous_last;
+		}
+		else if (block == m_top_last) {
+			m_top = header->m_previous_offset;
+			m_top_last = header->m_previous_last;
+		}
+	}
+	FORGE_FORCE_INLINE Size StackAllocationPolicy::GetAllocatedSize(VoidPtr address)
+	{
+		Byte* block = reinterpret_cast<Byte*>(address);
+
+		if (!block) {
+			return 0;
+		}
+
+		if (block == m_bottom_last) {
+			return static_cast<Size>(m_start + m_bottom - block);
+		}
+
+		if (block == m_top_last) {
+			Header* header = reinterpret_cast<Header*>(block - sizeof(Header));
+
+			return static_cast<Size>(m_start + header->m_previous_offset - block);
+		}
+
+		return 0;
+	}
+	FORGE_FORCE_INLINE Bool StackAllocationPolicy::Owns(VoidPtr address)
+	{
+		return static_cast<Size>(reinterpret_cast<Byte*>(address) - m_start) < m_capacity;
+	}
+
+	FORGE_FORCE_INLINE Void StackAllocationPolicy::Reset()
+	{
+		m_bottom = 0;
+		m_top = m_capacity;
+		m_bottom_last = nullptr;
+		m_top_last = nullptr;
+	}
+}
+
+#endif
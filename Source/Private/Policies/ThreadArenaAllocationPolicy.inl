@@ -0,0 +1,384 @@
+#ifndef THREAD_ARENA_ALLOCATION_POLICY_INL_HPP
+#define THREAD_ARENA_ALLOCATION_POLICY_INL_HPP
+
+#include <forge-memory/MemoryUtilities.hpp>
+#include <forge-memory/Policies/ThreadArenaAllocationPolicy.hpp>
+
+namespace Forge
+{
+	template<typename BackingPolicy, Size MaxSize>
+	ThreadArenaAllocationPolicy<BackingPolicy, MaxSize>::CentralStore::~CentralStore()
+	{
+		while (m_arenas) {
+			Arena* next = m_arenas->m_next;
+			delete m_arenas;
+			m_arenas = next;
+		}
+	}
+
+	template<typename BackingPolicy, Size MaxSize>
+	ThreadArenaAllocationPolicy<BackingPolicy, MaxSize>::ThreadArena::~ThreadArena()
+	{
+		::std::lock_guard<::std::mutex> lock(m_central_store->m_mutex);
+
+		if (!m_central_store->m_is_alive) {
+			return;
+		}
+
+		// The arena keeps its free lists and remote free queue, the next thread to adopt it picks them up.
+		m_arena->m_next_abandoned = m_central_store->m_abandoned_arenas;
+		m_central_store->m_abandoned_arenas = m_arena;
+	}
+
+	template<typename BackingPolicy, Size MaxSize>
+	FORGE_FORCE_INLINE ThreadArenaAllocationPolicy<BackingPolicy, MaxSize>::ThreadArenaAllocationPolicy()
+		: m_id(0), m_central_store(nullptr) {}
+
+	template<typename BackingPolicy, Size MaxSize>
+	FORGE_FORCE_INLINE Void ThreadArenaAllocationPolicy<BackingPolicy, MaxSize>::Initialize(Size capacity)
+	{
+		m_central_store = ::std::make_shared<CentralStore>();
+		m_central_store->m_chunks = nullptr;
+		m_central_store->m_large_blocks = nullptr;
+		m_central_store->m_arenas = nullptr;
+		m_central_store->m_abandoned_arenas = nullptr;
+		m_central_store->m_is_alive = true;
+
+		m_central_store->m_backing_policy.Initialize(capacity);
+
+		// A fresh id keeps threads from picking up arenas bound to a previous central store.
+		m_id = s_next_id.fetch_add(1, ::std::memory_order_relaxed);
+	}
+	template<typename BackingPolicy, Size MaxSize>
+	FORGE_FORCE_INLINE Void ThreadArenaAllocationPolicy<BackingPolicy, MaxSize>::Deinitialize()
+	{
+		if (!m_central_store) {
+			return;
+		}
+
+		{
+			::std::lock_guard<::std::mutex> lock(m_central_store->m_mutex);
+
+			ReleaseCentralStore();
+
+			m_central_store->m_backing_policy.Deinitialize();
+			m_central_store->m_is_alive = false;
+		}
+
+		m_central_store.reset();
+	}
+
+	template<typename BackingPolicy, Size MaxSize>
+	FORGE_FORCE_INLINE VoidPtr ThreadArenaAllocationPolicy<BackingPolicy, MaxSize>::Allocate(Size size, Size alignment)
+	{
+		if (size > SIZE_CLASSES[NUM_OF_SIZE_CLASSES - 1] || alignment > HEADER_SIZE) {
+			return AllocateLarge(size, alignment);
+		}
+
+		Size class_index = SizeClassTable<MaxSize>::GetSizeClassIndex(size);
+
+		Arena* arena = GetThreadArena();
+
+		if (!arena->m_free_lists[class_index]) {
+			ReclaimRemoteFrees(arena);
+		}
+
+		FreeBlock* block = arena->m_free_lists[class_index];
+
+		if (block) {
+			arena->m_free_lists[class_index] = block->m_next;
+			return block;
+		}
+
+		// Rounding the stride keeps every block in a chunk 16 byte aligned, the 8 byte size class included.
+		Size stride = (HEADER_SIZE + SIZE_CLASSES[class_index] + (HEADER_SIZE - 1)) & ~(HEADER_SIZE - 1);
+
+		if (static_cast<Size>(arena->m_end - arena->m_current) < stride && !RefillArena(arena, stride)) {
+			return nullptr;
+		}
+
+		BlockHeader* header = reinterpret_cast<BlockHeader*>(arena->m_current);
+		header->m_owner = arena;
+		header->m_class_index = class_index;
+
+		arena->m_current += stride;
+
+		return reinterpret_cast<Byte*>(header) + HEADER_SIZE;
+	}
+	template<typename BackingPolicy, Size MaxSize>
+	FORGE_FORCE_INLINE VoidPtr ThreadArenaAllocationPolicy<BackingPolicy, MaxSize>::Callocate(Size size, Byte value, Size alignment)
+	{
+		VoidPtr address = this->Allocate(size, alignment);
+
+		if (address) {
+			MemorySet(address, value, size);
+		}
+
+		return address;
+	}
+	template<typename BackingPolicy, Size MaxSize>
+	FORGE_FORCE_INLINE VoidPtr ThreadArenaAllocationPolicy<BackingPolicy, MaxSize>::Reallocate(VoidPtr address, Size size, Size alignment)
+	{
+		if (!address) {
+			return this->Allocate(size, alignment);
+		}
+
+		BlockHeader* header = reinterpret_cast<BlockHeader*>(reinterpret_cast<Byte*>(address) - HEADER_SIZE);
+
+		Size old_size = !header->m_owner ?
+			reinterpret_cast<LargeBlock*>(reinterpret_cast<Byte*>(address) - header->m_class_index)->m_size :
+			SIZE_CLASSES[header->m_class_index];
+
+		if (size <= old_size && (reinterpret_cast<Size>(address) & (alignment - 1)) == 0) {
+			return address;
+		}
+
+		VoidPtr new_address = this->Allocate(size, alignment);
+
+		if (new_address) {
+			MemoryCopy(new_address, address, old_size < size ? old_size : size);
+
+			this->Deallocate(address);
+		}
+
+		return new_address;
+	}
+
+	template<typename BackingPolicy, Size MaxSize>
+	FORGE_FORCE_INLINE Void ThreadArenaAllocationPolicy<BackingPolicy, MaxSize>::Deallocate(VoidPtr address)
+	{
+		if (!address) {
+			return;
+		}
+
+		BlockHeader* header = reinterpret_cast<BlockHeader*>(reinterpret_cast<Byte*>(address) - HEADER_SIZE);
+		Arena* owner = header->m_owner;
+
+		if (!owner) {
+			DeallocateLarge(header);
+			return;
+		}
+
+		FreeBlock* block = reinterpret_cast<FreeBlock*>(address);
+
+		if (owner == GetThreadArena()) {
+			block->m_next = owner->m_free_lists[header->m_class_index];
+			owner->m_free_lists[header->m_class_index] = block;
+
+			return;
+		}
+
+		// Only the owner ever pops, and it takes the whole queue at once, so pushing is free of ABA.
+		FreeBlock* head = owner->m_remote_free_list.load(::std::memory_order_relaxed);
+
+		do {
+			block->m_next = head;
+		} while (!owner->m_remote_free_list.compare_exchange_weak(head, block, ::std::memory_order_release, ::std::memory_order_relaxed));
+	}
+	template<typename BackingPolicy, Size MaxSize>
+	FORGE_FORCE_INLINE Size ThreadArenaAllocationPolicy<BackingPolicy, MaxSize>::GetAllocatedSize(VoidPtr address)
+	{
+		if (!address) {
+			return 0;
+		}
+
+		BlockHeader* header = reinterpret_cast<BlockHeader*>(reinterpret_cast<Byte*>(address) - HEADER_SIZE);
+
+		if (!header->m_owner) {
+			return reinterpret_cast<LargeBlock*>(reinterpret_cast<Byte*>(address) - header->m_class_index)->m_size;
+		}
+
+		return SIZE_CLASSES[header->m_class_index];
+	}
+
+	template<typename BackingPolicy, Size MaxSize>
+	FORGE_FORCE_INLINE Void ThreadArenaAllocationPolicy<BackingPolicy, MaxSize>::Reset()
+	{
+		if (!m_central_store) {
+			return;
+		}
+
+		::std::lock_guard<::std::mutex> lock(m_central_store->m_mutex);
+
+		ReleaseCentralStore();
+
+		m_central_store->m_backing_policy.Reset();
+	}
+
+	template<typename BackingPolicy, Size MaxSize>
+	FORGE_FORCE_INLINE typename ThreadArenaAllocationPolicy<BackingPolicy, MaxSize>::Arena*
+		ThreadArenaAllocationPolicy<BackingPolicy, MaxSize>::GetThreadArena()
+	{
+		ThreadArenaRegistry& registry = s_registry;
+
+		if (registry.m_last_id == m_id) {
+			return registry.m_last_arena;
+		}
+
+		Arena* arena = nullptr;
+
+		for (auto& entry : registry.m_arenas) {
+			if (entry.first == m_id) {
+				arena = entry.second->m_arena;
+				break;
+			}
+		}
+
+		if (!arena) {
+			// Drop arenas whose central store is only kept alive by this thread.
+			for (Size index = 0; index < registry.m_arenas.size();) {
+				if (registry.m_arenas[index].second->m_central_store.use_count() == 1) {
+					registry.m_arenas[index] = ::std::move(registry.m_arenas.back());
+					registry.m_arenas.pop_back();
+				}
+				else {
+					index++;
+				}
+			}
+
+			{
+				::std::lock_guard<::std::mutex> lock(m_central_store->m_mutex);
+
+				arena = m_central_store->m_abandoned_arenas;
+
+				if (arena) {
+					m_central_store->m_abandoned_arenas = arena->m_next_abandoned;
+				}
+				else {
+					arena = new Arena();
+					arena->m_next = m_central_store->m_arenas;
+
+					m_central_store->m_arenas = arena;
+				}
+			}
+
+			registry.m_arenas.emplace_back(m_id, ::std::unique_ptr<ThreadArena>(new ThreadArena{ m_central_store, arena }));
+		}
+
+		registry.m_last_id = m_id;
+		registry.m_last_arena = arena;
+
+		return arena;
+	}
+
+	template<typename BackingPolicy, Size MaxSize>
+	FORGE_FORCE_INLINE Void ThreadArenaAllocationPolicy<BackingPolicy, MaxSize>::ReclaimRemoteFrees(Arena* arena)
+	{
+		FreeBlock* block = arena->m_remote_free_list.exchange(nullptr, ::std::memory_order_acquire);
+
+		while (block) {
+			FreeBlock* next = block->m_next;
+			BlockHeader* header = reinterpret_cast<BlockHeader*>(reinterpret_cast<Byte*>(block) - HEADER_SIZE);
+
+			block->m_next = arena->m_free_lists[header->m_class_index];
+			arena->m_free_lists[header->m_class_index] = block;
+
+			block = next;
+		}
+	}
+	template<typename BackingPolicy, Size MaxSize>
+	FORGE_FORCE_INLINE Bool ThreadArenaAllocationPolicy<BackingPolicy, MaxSize>::RefillArena(Arena* arena, Size stride)
+	{
+		::std::lock_guard<::std::mutex> lock(m_central_store->m_mutex);
+
+		Chunk* chunk = reinterpret_cast<Chunk*>(m_central_store->m_backing_policy.Allocate(CHUNK_SIZE, HEADER_SIZE));
+
+		if (!chunk) {
+			return false;
+		}
+
+		chunk->m_next = m_central_store->m_chunks;
+		m_central_store->m_chunks = chunk;
+
+		arena->m_current = reinterpret_cast<Byte*>(chunk) + HEADER_SIZE;
+		arena->m_end = reinterpret_cast<Byte*>(chunk) + CHUNK_SIZE;
+
+		return true;
+	}
+
+	template<typename BackingPolicy, Size MaxSize>
+	FORGE_FORCE_INLINE VoidPtr ThreadArenaAllocationPolicy<BackingPolicy, MaxSize>::AllocateLarge(Size size, Size alignment)
+	{
+		if (alignment < HEADER_SIZE) {
+			alignment = HEADER_SIZE;
+		}
+
+		Size offset = (sizeof(LargeBlock) + sizeof(BlockHeader) + (alignment - 1)) & ~(alignment - 1);
+
+		::std::lock_guard<::std::mutex> lock(m_central_store->m_mutex);
+
+		LargeBlock* large_block = reinterpret_cast<LargeBlock*>(m_central_store->m_backing_policy.Allocate(offset + size, alignment));
+
+		if (!large_block) {
+			return nullptr;
+		}
+
+		large_block->m_next = m_central_store->m_large_blocks;
+		large_block->m_previous = nullptr;
+		large_block->m_size = size;
+
+		if (m_central_store->m_large_blocks) {
+			m_central_store->m_large_blocks->m_previous = large_block;
+		}
+
+		m_central_store->m_large_blocks = large_block;
+
+		Byte* address = reinterpret_cast<Byte*>(large_block) + offset;
+
+		BlockHeader* header = reinterpret_cast<BlockHeader*>(address - HEADER_SIZE);
+		header->m_owner = nullptr;
+		header->m_class_index = offset;
+
+		return address;
+	}
+	template<typename BackingPolicy, Size MaxSize>
+	FORGE_FORCE_INLINE Void ThreadArenaAllocationPolicy<BackingPolicy, MaxSize>::DeallocateLarge(BlockHeader* header)
+	{
+		LargeBlock* large_block = reinterpret_cast<LargeBlock*>(reinterpret_cast<Byte*>(header) + HEADER_SIZE - header->m_class_index);
+
+		::std::lock_guard<::std::mutex> lock(m_central_store->m_mutex);
+
+		if (large_block->m_previous) {
+			large_block->m_previous->m_next = large_block->m_next;
+		}
+		else {
+			m_central_store->m_large_blocks = large_block->m_next;
+		}
+
+		if (large_block->m_next) {
+			large_block->m_next->m_previous = large_block->m_previous;
+		}
+
+		m_central_store->m_backing_policy.Deallocate(large_block);
+	}
+
+	template<typename BackingPolicy, Size MaxSize>
+	FORGE_FORCE_INLINE Void ThreadArenaAllocationPolicy<BackingPolicy, MaxSize>::ReleaseCentralStore()
+	{
+		CentralStore& central_store = *m_central_store;
+
+		for (Arena* arena = central_store.m_arenas; arena; arena = arena->m_next) {
+			for (FreeBlock*& free_list : arena->m_free_lists) {
+				free_list = nullptr;
+			}
+
+			arena->m_current = nullptr;
+			arena->m_end = nullptr;
+			arena->m_remote_free_list.store(nullptr, ::std::memory_order_relaxed);
+		}
+
+		while (central_store.m_chunks) {
+			Chunk* next = central_store.m_chunks->m_next;
+			central_store.m_backing_policy.Deallocate(central_store.m_chunks);
+			central_store.m_chunks = next;
+		}
+
+		while (central_store.m_large_blocks) {
+			LargeBlock* next = central_store.m_large_blocks->m_next;
+			central_store.m_backing_policy.Deallocate(central_store.m_large_blocks);
+			central_store.m_large_blocks = next;
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,539 @@
+#ifndef THREAD_CACHE_ALLOCATION_POLICY_INL_HPP
+#define THREAD_CACHE_ALLOCATION_POLICY_INL_HPP
+
+#include <forge-memory/MemoryUtilities.hpp>
+#include <forge-memory/Policies/ThreadCacheAllocationPolicy.hpp>
+
+namespace Forge
+{
+	template<typename BackingPolicy, Size MaxSize>
+	ThreadCacheAllocationPolicy<BackingPolicy, MaxSize>::ThreadCache::~ThreadCache()
+	{
+		CentralStore& central_store = *m_central_store;
+
+		::std::lock_guard<::std::mutex> lock(central_store.m_mutex);
+
+		// Blocks of a reset or deinitialized store no longer belong to it and must not be touched.
+		if (!central_store.m_is_alive || m_generation != central_store.m_generation.load(::std::memory_order_relaxed)) {
+			return;
+		}
+
+		for (Size class_index = 0; class_index < NUM_OF_SIZE_CLASSES; class_index++) {
+			if (m_magazines[class_index].m_count) {
+				FlushMagazine(this, class_index, m_magazines[class_index].m_count);
+			}
+		}
+	}
+
+	template<typename BackingPolicy, Size MaxSize>
+	FORGE_FORCE_INLINE ThreadCacheAllocationPolicy<BackingPolicy, MaxSize>::ThreadCacheAllocationPolicy()
+		: m_id(0), m_central_store(nullptr) {}
+
+	template<typename BackingPolicy, Size MaxSize>
+	FORGE_FORCE_INLINE Size ThreadCacheAllocationPolicy<BackingPolicy, MaxSize>::GetThreadCacheSize()
+	{
+		return GetThreadCache()->m_cached_size;
+	}
+	template<typename BackingPolicy, Size MaxSize>
+	FORGE_FORCE_INLINE Void ThreadCacheAllocationPolicy<BackingPolicy, MaxSize>::FlushThreadCache()
+	{
+		ThreadCache* thread_cache = GetThreadCache();
+
+		for (Size class_index = 0; class_index < NUM_OF_SIZE_CLASSES; class_index++) {
+			if (thread_cache->m_magazines[class_index].m_count) {
+				FlushMagazine(thread_cache, class_index, thread_cache->m_magazines[class_index].m_count);
+			}
+		}
+	}
+
+	template<typename BackingPolicy, Size MaxSize>
+	FORGE_FORCE_INLINE Void ThreadCacheAllocationPolicy<BackingPolicy, MaxSize>::Initialize(Size capacity)
+	{
+		m_central_store = ::std::make_shared<CentralStore>();
+		m_central_store->m_large_blocks = nullptr;
+		m_central_store->m_is_alive = true;
+		m_central_store->m_generation.store(0, ::std::memory_order_relaxed);
+
+		for (CentralFreeList& free_list : m_central_store->m_free_lists) {
+			free_list.m_free_list = nullptr;
+			free_list.m_count = 0;
+		}
+
+		m_central_store->m_backing_policy.Initialize(capacity);
+
+		// A fresh id keeps threads from picking up caches bound to a previous central store.
+		m_id = s_next_id.fetch_add(1, ::std::memory_order_relaxed);
+	}
+	template<typename BackingPolicy, Size MaxSize>
+	FORGE_FORCE_INLINE Void ThreadCacheAllocationPolicy<BackingPolicy, MaxSize>::Deinitialize()
+	{
+		if (!m_central_store) {
+			return;
+		}
+
+		{
+			::std::lock_guard<::std::mutex> lock(m_central_store->m_mutex);
+
+			ReleaseCentralStore();
+
+			m_central_store->m_backing_policy.Deinitialize();
+			m_central_store->m_is_alive = false;
+		}
+
+		m_central_store.reset();
+	}
+
+	template<typename BackingPolicy, Size MaxSize>
+	FORGE_FORCE_INLINE VoidPtr ThreadCacheAllocationPolicy<BackingPolicy, MaxSize>::Allocate(Size size, Size alignment)
+	{
+		Size class_index = GetClassIndex(size, alignment);
+
+		if (class_index == LARGE_CLASS) {
+			return AllocateLarge(size, alignment);
+		}
+
+		ThreadCache* thread_cache = GetThreadCache();
+		Magazine& magazine = thread_cache->m_magazines[class_index];
+
+		if (!magazine.m_free_list && !RefillMagazine(thread_cache, class_index)) {
+			return nullptr;
+		}
+
+		FreeBlock* block = magazine.m_free_list;
+
+		magazine.m_free_list = block->m_next;
+		magazine.m_count -= 1;
+
+		thread_cache->m_cached_size -= SIZE_CLASSES[class_index];
+
+		return block;
+	}
+	template<typename BackingPolicy, Size MaxSize>
+	FORGE_FORCE_INLINE VoidPtr ThreadCacheAllocationPolicy<BackingPolicy, MaxSize>::Callocate(Size size, Byte value, Size alignment)
+	{
+		VoidPtr address = this->Allocate(size, alignment);
+
+		if (address) {
+			MemorySet(address, value, size);
+		}
+
+		return address;
+	}
+	template<typename BackingPolicy, Size MaxSize>
+	FORGE_FORCE_INLINE VoidPtr ThreadCacheAllocationPolicy<BackingPolicy, MaxSize>::Reallocate(VoidPtr address, Size size, Size alignment)
+	{
+		if (!address) {
+			return this->Allocate(size, alignment);
+		}
+
+		Size page_value = m_central_store->m_page_map.Get(address);
+		Size old_size = this->GetAllocatedSize(address);
+
+		// Staying in the same size class keeps the block reachable by a sized deallocation with the new size.
+		Bool is_same_class = GetClassIndex(size, alignment) == (page_value ? page_value - 1 : LARGE_CLASS);
+
+		if (is_same_class && size <= old_size && (reinterpret_cast<Size>(address) & (alignment - 1)) == 0) {
+			// Large blocks report the size they were last given, like GetRoundedSize assumes.
+			if (!page_value) {
+				BlockHeader* header = reinterpret_cast<BlockHeader*>(reinterpret_cast<Byte*>(address) - sizeof(BlockHeader));
+
+				reinterpret_cast<LargeBlock*>(reinterpret_cast<Byte*>(address) - header->m_offset)->m_size = size;
+			}
+
+			return address;
+		}
+
+		VoidPtr new_address = this->Allocate(size, alignment);
+
+		if (new_address) {
+			MemoryCopy(new_address, address, old_size < size ? old_size : size);
+
+			this->Deallocate(address);
+		}
+
+		return new_address;
+	}
+	template<typename BackingPolicy, Size MaxSize>
+	FORGE_FORCE_INLINE AllocationResult ThreadCacheAllocationPolicy<BackingPolicy, MaxSize>::AllocateAtLeast(Size size, Size alignment)
+	{
+		VoidPtr address = this->Allocate(size, alignment);
+
+		if (!address) {
+			return AllocationResult{ nullptr, 0 };
+		}
+
+		Size class_index = GetClassIndex(size, alignment);
+
+		return AllocationResult{ address, class_index == LARGE_CLASS ? size : SIZE_CLASSES[class_index] };
+	}
+
+	template<typename BackingPolicy, Size MaxSize>
+	FORGE_FORCE_INLINE Void ThreadCacheAllocationPolicy<BackingPolicy, MaxSize>::Deallocate(VoidPtr address)
+	{
+		if (!address) {
+			return;
+		}
+
+		Size page_value = m_central_store->m_page_map.Get(address);
+
+		if (!page_value) {
+			DeallocateLarge(reinterpret_cast<BlockHeader*>(reinterpret_cast<Byte*>(address) - sizeof(BlockHeader)));
+			return;
+		}
+
+		DeallocateSmall(address, page_value - 1);
+	}
+	template<typename BackingPolicy, Size MaxSize>
+	FORGE_FORCE_INLINE Void ThreadCacheAllocationPolicy<BackingPolicy, MaxSize>::DeallocateSized(VoidPtr address, Size size, Size alignment)
+	{
+		if (!address) {
+			return;
+		}
+
+		Size class_index = GetClassIndex(size, alignment);
+
+		if (class_index == LARGE_CLASS) {
+			DeallocateLarge(reinterpret_cast<BlockHeader*>(reinterpret_cast<Byte*>(address) - sizeof(BlockHeader)));
+			return;
+		}
+
+		DeallocateSmall(address, class_index);
+	}
+	template<typename BackingPolicy, Size MaxSize>
+	FORGE_FORCE_INLINE Size ThreadCacheAllocationPolicy<BackingPolicy, MaxSize>::GetAllocatedSize(VoidPtr address)
+	{
+		if (!address) {
+			return 0;
+		}
+
+		Size page_value = m_central_store->m_page_map.Get(address);
+
+		if (!page_value) {
+			BlockHeader* header = reinterpret_cast<BlockHeader*>(reinterpret_cast<Byte*>(address) - sizeof(BlockHeader));
+
+			return reinterpret_cast<LargeBlock*>(reinterpret_cast<Byte*>(address) - header->m_offset)->m_size;
+		}
+
+		return SIZE_CLASSES[page_value - 1];
+	}
+	template<typename BackingPolicy, Size MaxSize>
+	FORGE_FORCE_INLINE Size ThreadCacheAllocationPolicy<BackingPolicy, MaxSize>::GetRoundedSize(VoidPtr address, Size size, Size alignment)
+	{
+		if (!address) {
+			return 0;
+		}
+
+		Size class_index = GetClassIndex(size, alignment);
+
+		return class_index == LARGE_CLASS ? size : SIZE_CLASSES[class_index];
+	}
+
+	template<typename BackingPolicy, Size MaxSize>
+	FORGE_FORCE_INLINE Void ThreadCacheAllocationPolicy<BackingPolicy, MaxSize>::Reset()
+	{
+		if (!m_central_store) {
+			return;
+		}
+
+		::std::lock_guard<::std::mutex> lock(m_central_store->m_mutex);
+
+		ReleaseCentralStore();
+
+		m_central_store->m_backing_policy.Reset();
+	}
+
+	template<typename BackingPolicy, Size MaxSize>
+	FORGE_FORCE_INLINE Size ThreadCacheAllocationPolicy<BackingPolicy, MaxSize>::GetClassIndex(Size size, Size alignment)
+	{
+		if (size > SIZE_CLASSES[NUM_OF_SIZE_CLASSES - 1] || alignment > HEADER_SIZE) {
+			return LARGE_CLASS;
+		}
+
+		Size class_index = SizeClassTable<MaxSize>::GetSizeClassIndex(size);
+
+		// The 8 byte size class is only 8 byte aligned, every other size class is a multiple of 16.
+		if (class_index == 0 && alignment > 8) {
+			class_index = 1;
+		}
+
+		return class_index;
+	}
+	template<typename BackingPolicy, Size MaxSize>
+	FORGE_FORCE_INLINE Size ThreadCacheAllocationPolicy<BackingPolicy, MaxSize>::GetMagazineCapacity(Size class_index)
+	{
+		Size capacity = MAGAZINE_SIZE / SIZE_CLASSES[class_index];
+
+		return capacity < 4 ? 4 : (capacity > MAX_MAGAZINE_COUNT ? MAX_MAGAZINE_COUNT : capacity);
+	}
+	template<typename BackingPolicy, Size MaxSize>
+	FORGE_FORCE_INLINE Size ThreadCacheAllocationPolicy<BackingPolicy, MaxSize>::GetBatchSize(Size class_index)
+	{
+		return GetMagazineCapacity(class_index) / 2;
+	}
+
+	template<typename BackingPolicy, Size MaxSize>
+	FORGE_FORCE_INLINE Void ThreadCacheAllocationPolicy<BackingPolicy, MaxSize>::FlushMagazine(ThreadCache* thread_cache, Size class_index, Size count)
+	{
+		Magazine& magazine = thread_cache->m_magazines[class_index];
+
+		FreeBlock* head = magazine.m_free_list;
+		FreeBlock* tail = head;
+
+		for (Size counter = 1; counter < count; counter++) {
+			tail = tail->m_next;
+		}
+
+		magazine.m_free_list = tail->m_next;
+		magazine.m_count -= count;
+
+		thread_cache->m_cached_size -= count * SIZE_CLASSES[class_index];
+
+		CentralFreeList& central_free_list = thread_cache->m_central_store->m_free_lists[class_index];
+
+		::std::lock_guard<::std::mutex> lock(central_free_list.m_mutex);
+
+		tail->m_next = central_free_list.m_free_list;
+
+		central_free_list.m_free_list = head;
+		central_free_list.m_count += count;
+	}
+
+	template<typename BackingPolicy, Size MaxSize>
+	FORGE_FORCE_INLINE typename ThreadCacheAllocationPolicy<BackingPolicy, MaxSize>::ThreadCache*
+		ThreadCacheAllocationPolicy<BackingPolicy, MaxSize>::GetThreadCache()
+	{
+		ThreadCacheRegistry& registry = s_registry;
+		ThreadCache* thread_cache = registry.m_last_cache;
+
+		if (registry.m_last_id != m_id) {
+			thread_cache = nullptr;
+
+			for (auto& entry : registry.m_caches) {
+				if (entry.first == m_id) {
+					thread_cache = entry.second.get();
+					break;
+				}
+			}
+
+			if (!thread_cache) {
+				// Drop caches whose central store is only kept alive by this thread.
+				for (Size index = 0; index < registry.m_caches.size();) {
+					if (registry.m_caches[index].second->m_central_store.use_count() == 1) {
+						registry.m_caches[index] = ::std::move(registry.m_caches.back());
+						registry.m_caches.pop_back();
+					}
+					else {
+						index++;
+					}
+				}
+
+				ThreadCache* new_cache = new ThreadCache{ m_central_store, m_central_store->m_generation.load(::std::memory_order_relaxed), 0, {} };
+				registry.m_caches.emplace_back(m_id, ::std::unique_ptr<ThreadCache>(new_cache));
+
+				thread_cache = new_cache;
+			}
+
+			registry.m_last_id = m_id;
+			registry.m_last_cache = thread_cache;
+		}
+
+		Size generation = m_central_store->m_generation.load(::std::memory_order_acquire);
+
+		if (thread_cache->m_generation != generation) {
+			for (Magazine& magazine : thread_cache->m_magazines) {
+				magazine = Magazine{ nullptr, 0 };
+			}
+
+			thread_cache->m_generation = generation;
+			thread_cache->m_cached_size = 0;
+		}
+
+		return thread_cache;
+	}
+
+	template<typename BackingPolicy, Size MaxSize>
+	FORGE_FORCE_INLINE Bool ThreadCacheAllocationPolicy<BackingPolicy, MaxSize>::RefillMagazine(ThreadCache* thread_cache, Size class_index)
+	{
+		Magazine& magazine = thread_cache->m_magazines[class_index];
+		CentralFreeList& central_free_list = m_central_store->m_free_lists[class_index];
+
+		Size batch_size = GetBatchSize(class_index);
+		Size block_size = SIZE_CLASSES[class_index];
+
+		{
+			::std::lock_guard<::std::mutex> lock(central_free_list.m_mutex);
+
+			if (central_free_list.m_free_list) {
+				FreeBlock* head = central_free_list.m_free_list;
+				FreeBlock* tail = head;
+				Size count = 1;
+
+				while (count < batch_size && tail->m_next) {
+					tail = tail->m_next;
+					count++;
+				}
+
+				central_free_list.m_free_list = tail->m_next;
+				central_free_list.m_count -= count;
+
+				tail->m_next = nullptr;
+
+				magazine.m_free_list = head;
+				magazine.m_count = count;
+
+				thread_cache->m_cached_size += count * block_size;
+
+				return true;
+			}
+		}
+
+		// The central store is empty, carve at least a whole batch out of a new span from the backing policy.
+		Size span_size = (batch_size * block_size + (PAGE_SIZE - 1)) & ~(PAGE_SIZE - 1);
+		Size count = span_size / block_size;
+
+		::std::lock_guard<::std::mutex> lock(m_central_store->m_mutex);
+
+		Byte* span = reinterpret_cast<Byte*>(m_central_store->m_backing_policy.Allocate(span_size, PAGE_SIZE));
+
+		if (!span) {
+			return false;
+		}
+
+		if (!m_central_store->m_page_map.Set(span, span_size, class_index + 1)) {
+			m_central_store->m_page_map.Set(span, span_size, 0);
+			m_central_store->m_backing_policy.Deallocate(span);
+
+			return false;
+		}
+
+		m_central_store->m_spans.emplace_back(span, span_size);
+
+		FreeBlock* free_list = nullptr;
+		Byte* block = span + count * block_size;
+
+		for (Size counter = 0; counter < count; counter++) {
+			block -= block_size;
+
+			FreeBlock* free_block = reinterpret_cast<FreeBlock*>(block);
+			free_block->m_next = free_list;
+
+			free_list = free_block;
+		}
+
+		magazine.m_free_list = free_list;
+		magazine.m_count = count;
+
+		thread_cache->m_cached_size += count * block_size;
+
+		return true;
+	}
+	template<typename BackingPolicy, Size MaxSize>
+	FORGE_FORCE_INLINE Void ThreadCacheAllocationPolicy<BackingPolicy, MaxSize>::DeallocateSmall(VoidPtr address, Size class_index)
+	{
+		ThreadCache* thread_cache = GetThreadCache();
+		Magazine& magazine = thread_cache->m_magazines[class_index];
+
+		FreeBlock* block = reinterpret_cast<FreeBlock*>(address);
+		block->m_next = magazine.m_free_list;
+
+		magazine.m_free_list = block;
+		magazine.m_count += 1;
+
+		thread_cache->m_cached_size += SIZE_CLASSES[class_index];
+
+		if (magazine.m_count > GetMagazineCapacity(class_index)) {
+			FlushMagazine(thread_cache, class_index, GetBatchSize(class_index));
+		}
+		else if (thread_cache->m_cached_size > MAX_THREAD_CACHE_SIZE) {
+			FlushMagazine(thread_cache, class_index, (magazine.m_count + 1) / 2);
+		}
+	}
+
+	template<typename BackingPolicy, Size MaxSize>
+	FORGE_FORCE_INLINE VoidPtr ThreadCacheAllocationPolicy<BackingPolicy, MaxSize>::AllocateLarge(Size size, Size alignment)
+	{
+		if (alignment < HEADER_SIZE) {
+			alignment = HEADER_SIZE;
+		}
+
+		Size offset = (sizeof(LargeBlock) + sizeof(BlockHeader) + (alignment - 1)) & ~(alignment - 1);
+
+		::std::lock_guard<::std::mutex> lock(m_central_store->m_mutex);
+
+		LargeBlock* large_block = reinterpret_cast<LargeBlock*>(m_central_store->m_backing_policy.Allocate(offset + size, alignment));
+
+		if (!large_block) {
+			return nullptr;
+		}
+
+		large_block->m_next = m_central_store->m_large_blocks;
+		large_block->m_previous = nullptr;
+		large_block->m_size = size;
+
+		if (m_central_store->m_large_blocks) {
+			m_central_store->m_large_blocks->m_previous = large_block;
+		}
+
+		m_central_store->m_large_blocks = large_block;
+
+		Byte* address = reinterpret_cast<Byte*>(large_block) + offset;
+
+		BlockHeader* header = reinterpret_cast<BlockHeader*>(address - sizeof(BlockHeader));
+		header->m_class_index = LARGE_CLASS;
+		header->m_offset = offset;
+
+		return address;
+	}
+	template<typename BackingPolicy, Size MaxSize>
+	FORGE_FORCE_INLINE Void ThreadCacheAllocationPolicy<BackingPolicy, MaxSize>::DeallocateLarge(BlockHeader* header)
+	{
+		LargeBlock* large_block = reinterpret_cast<LargeBlock*>(reinterpret_cast<Byte*>(header) + sizeof(BlockHeader) - header->m_offset);
+
+		::std::lock_guard<::std::mutex> lock(m_central_store->m_mutex);
+
+		if (large_block->m_previous) {
+			large_block->m_previous->m_next = large_block->m_next;
+		}
+		else {
+			m_central_store->m_large_blocks = large_block->m_next;
+		}
+
+		if (large_block->m_next) {
+			large_block->m_next->m_previous = large_block->m_previous;
+		}
+
+		m_central_store->m_backing_policy.Deallocate(large_block);
+	}
+
+	template<typename BackingPolicy, Size MaxSize>
+	FORGE_FORCE_INLINE Void ThreadCacheAllocationPolicy<BackingPolicy, MaxSize>::ReleaseCentralStore()
+	{
+		CentralStore& central_store = *m_central_store;
+
+		// Bumping the generation makes every thread drop its magazines without touching the released blocks.
+		central_store.m_generation.fetch_add(1, ::std::memory_order_release);
+
+		for (CentralFreeList& central_free_list : central_store.m_free_lists) {
+			::std::lock_guard<::std::mutex> lock(central_free_list.m_mutex);
+
+			central_free_list.m_free_list = nullptr;
+			central_free_list.m_count = 0;
+		}
+
+		// Unmapping the pages keeps large blocks later allocated at the same addresses from being taken for small blocks.
+		for (auto& span : central_store.m_spans) {
+			central_store.m_page_map.Set(span.first, span.second, 0);
+			central_store.m_backing_policy.Deallocate(span.first);
+		}
+
+		central_store.m_spans.clear();
+
+		while (central_store.m_large_blocks) {
+			LargeBlock* next = central_store.m_large_blocks->m_next;
+			central_store.m_backing_policy.Deallocate(central_store.m_large_blocks);
+			central_store.m_large_blocks = next;
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,188 @@
+#ifndef VIRTUAL_MEMORY_ALLOCATION_POLICY_INL_HPP
+#define VIRTUAL_MEMORY_ALLOCATION_POLICY_INL_HPP
+
+#include <forge-memory/VirtualMemory.hpp>
+#include <forge-memory/MemoryUtilities.hpp>
+#include <forge-memory/Policies/VirtualMemoryAllocationPolicy.hpp>
+
+namespace Forge
+{
+	FORGE_FORCE_INLINE VirtualMemoryAllocationPolicy::VirtualMemoryAllocationPolicy(PageBacking page_backing)
+		: m_start(nullptr), m_offset(0), m_committed(0), m_capacity(0),
+		  m_page_backing(page_backing), m_commit_granularity(COMMIT_GRANULARITY), m_is_huge_page_backed(false),
+		  m_last_address(nullptr) {}
+
+	FORGE_FORCE_INLINE Void VirtualMemoryAllocationPolicy::Initialize(Size capacity)
+	{
+		Size page_size = VirtualGetPageSize();
+		Size huge_page_size = VirtualGetHugePageSize();
+
+		// Huge page backed ranges are reserved, committed and decommitted in whole huge pages.
+		if (m_page_backing != PageBacking::Normal && huge_page_size) {
+			page_size = huge_page_size;
+		}
+
+		capacity = (capacity + (page_size - 1)) & ~(page_size - 1);
+
+		m_is_huge_page_backed = false;
+
+		if (!capacity) {
+			m_start = nullptr;
+		}
+		else if (m_page_backing != PageBacking::Normal && huge_page_size) {
+			m_start = reinterpret_cast<Byte*>(VirtualReserve(capacity, m_page_backing, m_is_huge_page_backed));
+		}
+		else {
+			m_start = reinterpret_cast<Byte*>(VirtualReserve(capacity));
+		}
+
+		m_commit_granularity = page_size > COMMIT_GRANULARITY ? page_size : COMMIT_GRANULARITY;
+		m_offset = 0;
+		m_committed = 0;
+		m_capacity = m_start ? capacity : 0;
+		m_last_address = nullptr;
+	}
+	FORGE_FORCE_INLINE Void VirtualMemoryAllocationPolicy::Deinitialize()
+	{
+		if (m_start) {
+			VirtualRelease(m_start, m_capacity);
+		}
+
+		m_start = nullptr;
+		m_offset = 0;
+		m_committed = 0;
+		m_capacity = 0;
+		m_is_huge_page_backed = false;
+		m_last_address = nullptr;
+	}
+
+	FORGE_FORCE_INLINE VoidPtr VirtualMemoryAllocationPolicy::Allocate(Size size, Size alignment)
+	{
+		Byte* current = m_start + m_offset;
+		Byte* aligned = reinterpret_cast<Byte*>(MemoryAlignForward(current, alignment));
+
+		Size padding = static_cast<Size>(aligned - current);
+
+		if (padding + size > m_capacity - m_offset) {
+			return nullptr;
+		}
+
+		if (m_offset + padding + size > m_committed && !Commit(m_offset + padding + size)) {
+			return nullptr;
+		}
+
+		m_offset += padding + size;
+		m_last_address = aligned;
+
+		return aligned;
+	}
+	FORGE_FORCE_INLINE VoidPtr VirtualMemoryAllocationPolicy::Callocate(Size size, Byte value, Size alignment)
+	{
+		VoidPtr address = this->Allocate(size, alignment);
+
+		if (address) {
+			MemorySet(address, value, size);
+		}
+
+		return address;
+	}
+	FORGE_FORCE_INLINE VoidPtr VirtualMemoryAllocationPolicy::Reallocate(VoidPtr address, Size size, Size alignment)
+	{
+		if (!address) {
+			return this->Allocate(size, alignment);
+		}
+
+		Size offset = static_cast<Size>(reinterpret_cast<Byte*>(address) - m_start);
+
+		if (address == m_last_address && (reinterpret_cast<Size>(address) & (alignment - 1)) == 0) {
+			if (size > m_capacity - offset) {
+				return nullptr;
+			}
+
+			if (offset + size > m_committed && !Commit(offset + size)) {
+				return nullptr;
+			}
+
+			m_offset = offset + size;
+
+			return address;
+		}
+
+		VoidPtr new_address = this->Allocate(size, alignment);
+
+		if (new_address) {
+			// Blocks are laid out contiguously, so the old block never extends past the previous bump offset.
+			Size old_size = static_cast<Size>(reinterpret_cast<Byte*>(new_address) - reinterpret_cast<Byte*>(address));
+
+			MemoryCopy(new_address, address, old_size < size ? old_size : size);
+		}
+
+		return new_address;
+	}
+
+	FORGE_FORCE_INLINE Void VirtualMemoryAllocationPolicy::Deallocate(VoidPtr address)
+	{
+		// Do Nothing
+	}
+	FORGE_FORCE_INLINE Size VirtualMemoryAllocationPolicy::GetAllocatedSize(VoidPtr address)
+	{
+		if (!address || address != m_last_address) {
+			return 0;
+		}
+
+		return static_cast<Size>(m_start + m_offset - reinterpret_cast<Byte*>(address));
+	}
+	FORGE_FORCE_INLINE Bool VirtualMemoryAllocationPolicy::Owns(VoidPtr address)
+	{
+		return static_cast<Size>(reinterpret_cast<Byte*>(address) - m_start) < m_capacity;
+	}
+
+	FORGE_FORCE_INLINE Void VirtualMemoryAllocationPolicy::Reset()
+	{
+		if (m_committed) {
+			VirtualDecommit(m_start, m_committed);
+		}
+
+		m_offset = 0;
+		m_committed = 0;
+		m_last_address = nullptr;
+	}
+
+	FORGE_FORCE_INLINE Void VirtualMemoryAllocationPolicy::SetPageBacking(PageBacking page_backing)
+	{
+		m_page_backing = page_backing;
+	}
+	FORGE_FORCE_INLINE PageBacking VirtualMemoryAllocationPolicy::GetPageBacking() const
+	{
+		return m_page_backing;
+	}
+	FORGE_FORCE_INLINE Bool VirtualMemoryAllocationPolicy::IsHugePageBacked() const
+	{
+		return m_is_huge_page_backed;
+	}
+
+	FORGE_FORCE_INLINE Size VirtualMemoryAllocationPolicy::GetCommittedSize() const
+	{
+		return m_committed;
+	}
+
+	FORGE_FORCE_INLINE Bool VirtualMemoryAllocationPolicy::Commit(Size offset)
+	{
+		// Committing in large steps keeps the number of system calls low as the bump pointer advances.
+		Size committed = (offset + (m_commit_granularity - 1)) & ~(m_commit_granularity - 1);
+
+		if (committed > m_capacity) {
+			committed = m_capacity;
+		}
+
+		if (!VirtualCommit(m_start + m_committed, committed - m_committed)) {
+			return false;
+		}
+
+		m_committed = committed;
+
+		return true;
+	}
+}
+
+#endif
@@ -0,0 +1,62 @@
+#ifndef SIZE_CLASS_TABLE_INL_HPP
+#define SIZE_CLASS_TABLE_INL_HPP
+
+#include <forge-memory/BitUtilities.hpp>
+#include <forge-memory/SizeClassTable.hpp>
+
+namespace Forge
+{
+	template<Size MaxSize>
+	constexpr Size SizeClassTable<MaxSize>::GetNumOfSizeClasses()
+	{
+		Size count = 9;
+
+		for (Size band = 128; band < MaxSize; band <<= 1) {
+			for (Size step = 1; step <= 4 && band + step * (band >> 2) <= MaxSize; step++) {
+				count++;
+			}
+		}
+
+		return count;
+	}
+
+	template<Size MaxSize>
+	constexpr auto SizeClassTable<MaxSize>::GenerateSizeClasses()
+	{
+		::std::array<Size, GetNumOfSizeClasses()> size_classes = {};
+
+		size_classes[0] = 8;
+
+		for (Size index = 1; index < 9; index++) {
+			size_classes[index] = index << 4;
+		}
+
+		Size index = 9;
+
+		for (Size band = 128; band < MaxSize; band <<= 1) {
+			for (Size step = 1; step <= 4 && band + step * (band >> 2) <= MaxSize; step++) {
+				size_classes[index++] = band + step * (band >> 2);
+			}
+		}
+
+		return size_classes;
+	}
+
+	template<Size MaxSize>
+	FORGE_FORCE_INLINE Size SizeClassTable<MaxSize>::GetSizeClassIndex(Size size)
+	{
+		if (size <= 8) {
+			return 0;
+		}
+
+		if (size <= 128) {
+			return (size + 15) >> 4;
+		}
+
+		Size band = BitScanReverse(size - 1);
+
+		return 9 + ((band - 7) << 2) + ((size - 1 - (static_cast<Size>(1) << band)) >> (band - 2));
+	}
+}
+
+#endif
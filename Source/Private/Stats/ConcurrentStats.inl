@@ -0,0 +1,137 @@
+#ifndef CONCURRENT_STATS_INL_HPP
+#define CONCURRENT_STATS_INL_HPP
+
+#include <type_traits>
+
+#include <forge-memory/Stats/ConcurrentStats.hpp>
+
+namespace Forge
+{
+	FORGE_FORCE_INLINE ConcurrentStats::ConcurrentStats()
+		: m_shards(), m_peak_size(0) {}
+
+	FORGE_FORCE_INLINE Void ConcurrentStats::OnAllocate(VoidPtr address, Size size, Size alignment, Size allocated_size)
+	{
+		Shard& shard = GetShard();
+
+		shard.m_total_size.fetch_add(allocated_size, ::std::memory_order_relaxed);
+
+		Size num_of_allocations = shard.m_num_of_allocations.fetch_add(1, ::std::memory_order_relaxed) + 1;
+
+		if (num_of_allocations % PEAK_SAMPLE_INTERVAL == 0) {
+			SamplePeakSize();
+		}
+	}
+	FORGE_FORCE_INLINE Void ConcurrentStats::OnCallocate(VoidPtr address, Size size, Byte value, Size alignment, Size allocated_size)
+	{
+		OnAllocate(address, size, alignment, allocated_size);
+	}
+	FORGE_FORCE_INLINE Void ConcurrentStats::OnReallocate(VoidPtr old_address, VoidPtr new_address, Size size, Size alignment, Size old_allocated_size, Size allocated_size)
+	{
+		Shard& shard = GetShard();
+
+		// Unsigned wrap around keeps the sum over all shards exact even if this shard goes below zero.
+		shard.m_total_size.fetch_add(allocated_size - old_allocated_size, ::std::memory_order_relaxed);
+
+		Size num_of_allocations = shard.m_num_of_allocations.fetch_add(1, ::std::memory_order_relaxed) + 1;
+
+		if (num_of_allocations % PEAK_SAMPLE_INTERVAL == 0) {
+			SamplePeakSize();
+		}
+	}
+	FORGE_FORCE_INLINE Void ConcurrentStats::OnAllocateBatch(const VoidPtr* addresses, Size count, Size size, Size alignment, Size allocated_size)
+	{
+		Shard& shard = GetShard();
+
+		shard.m_total_size.fetch_add(allocated_size, ::std::memory_order_relaxed);
+
+		Size num_of_allocations = shard.m_num_of_allocations.fetch_add(count, ::std::memory_order_relaxed);
+
+		if (num_of_allocations / PEAK_SAMPLE_INTERVAL != (num_of_allocations + count) / PEAK_SAMPLE_INTERVAL) {
+			SamplePeakSize();
+		}
+	}
+	FORGE_FORCE_INLINE Void ConcurrentStats::OnDeallocate(VoidPtr address, Size allocated_size)
+	{
+		Shard& shard = GetShard();
+
+		shard.m_total_size.fetch_sub(allocated_size, ::std::memory_order_relaxed);
+		shard.m_num_of_deallocations.fetch_add(1, ::std::memory_order_relaxed);
+	}
+	FORGE_FORCE_INLINE Void ConcurrentStats::OnDeallocateBatch(const VoidPtr* addresses, Size count, Size allocated_size)
+	{
+		Shard& shard = GetShard();
+
+		shard.m_total_size.fetch_sub(allocated_size, ::std::memory_order_relaxed);
+		shard.m_num_of_deallocations.fetch_add(count, ::std::memory_order_relaxed);
+	}
+	FORGE_FORCE_INLINE Void ConcurrentStats::Reset()
+	{
+		for (Shard& shard : m_shards) {
+			shard.m_total_size.store(0, ::std::memory_order_relaxed);
+			shard.m_num_of_allocations.store(0, ::std::memory_order_relaxed);
+			shard.m_num_of_deallocations.store(0, ::std::memory_order_relaxed);
+		}
+
+		m_peak_size.store(0, ::std::memory_order_relaxed);
+	}
+
+	FORGE_FORCE_INLINE Size ConcurrentStats::GetPeakSize() const
+	{
+		SamplePeakSize();
+
+		return m_peak_size.load(::std::memory_order_relaxed);
+	}
+	FORGE_FORCE_INLINE Size ConcurrentStats::GetTotalSize() const
+	{
+		Size total_size = 0;
+
+		for (const Shard& shard : m_shards) {
+			total_size += shard.m_total_size.load(::std::memory_order_relaxed);
+		}
+
+		return total_size;
+	}
+	FORGE_FORCE_INLINE Size ConcurrentStats::GetNumOfAllocations() const
+	{
+		Size num_of_allocations = 0;
+
+		for (const Shard& shard : m_shards) {
+			num_of_allocations += shard.m_num_of_allocations.load(::std::memory_order_relaxed);
+		}
+
+		return num_of_allocations;
+	}
+	FORGE_FORCE_INLINE Size ConcurrentStats::GetNumOfDeallocations() const
+	{
+		Size num_of_deallocations = 0;
+
+		for (const Shard& shard : m_shards) {
+			num_of_deallocations += shard.m_num_of_deallocations.load(::std::memory_order_relaxed);
+		}
+
+		return num_of_deallocations;
+	}
+
+	FORGE_FORCE_INLINE ConcurrentStats::Shard& ConcurrentStats::GetShard()
+	{
+		return m_shards[s_shard_index];
+	}
+
+	FORGE_FORCE_INLINE Void ConcurrentStats::SamplePeakSize() const
+	{
+		Size total_size = GetTotalSize();
+
+		// A sum read while other threads update their shards may be torn and wrap below zero, which is discarded.
+		if (static_cast<::std::make_signed_t<Size>>(total_size) < 0) {
+			return;
+		}
+
+		Size peak_size = m_peak_size.load(::std::memory_order_relaxed);
+
+		while (peak_size < total_size && !m_peak_size.compare_exchange_weak(peak_size, total_size, ::std::memory_order_relaxed)) {
+		}
+	}
+}
+
+#endif
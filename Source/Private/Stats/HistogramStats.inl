@@ -0,0 +1,218 @@
+#ifndef HISTOGRAM_STATS_INL_HPP
+#define HISTOGRAM_STATS_INL_HPP
+
+#include <cstring>
+
+#include <forge-memory/BitUtilities.hpp>
+#include <forge-memory/Stats/HistogramStats.hpp>
+
+namespace Forge
+{
+	FORGE_FORCE_INLINE ::std::string HistogramSnapshot::ToJson() const
+	{
+		::std::string json;
+
+		auto append_histogram = [&json](const char* name, const Size* histogram) {
+			json += ",\"";
+			json += name;
+			json += "\":[";
+
+			Bool is_first = true;
+
+			for (Size index = 0; index < NUM_OF_BUCKETS; index++) {
+				if (!histogram[index]) {
+					continue;
+				}
+
+				json += is_first ? "{\"lower_bound\":" : ",{\"lower_bound\":";
+				json += ::std::to_string(index ? Size(1) << index : 0);
+				json += ",\"count\":";
+				json += ::std::to_string(histogram[index]);
+				json += "}";
+
+				is_first = false;
+			}
+
+			json += "]";
+		};
+
+		json += "{\"peak_size\":" + ::std::to_string(m_peak_size);
+		json += ",\"total_size\":" + ::std::to_string(m_total_size);
+		json += ",\"num_of_allocations\":" + ::std::to_string(m_num_of_allocations);
+		json += ",\"num_of_deallocations\":" + ::std::to_string(m_num_of_deallocations);
+		json += ",\"is_latency_recorded\":";
+		json += m_is_latency_recorded ? "true" : "false";
+
+		append_histogram("size", m_size_histogram);
+		append_histogram("alignment", m_alignment_histogram);
+
+		if (m_is_latency_recorded) {
+			append_histogram("allocate_latency", m_allocate_latency_histogram);
+			append_histogram("reallocate_latency", m_reallocate_latency_histogram);
+			append_histogram("deallocate_latency", m_deallocate_latency_histogram);
+		}
+
+		json += "}";
+
+		return json;
+	}
+	FORGE_FORCE_INLINE ::std::string HistogramSnapshot::ToCsv() const
+	{
+		::std::string csv = "histogram,lower_bound,upper_bound,count\n";
+
+		auto append_histogram = [&csv](const char* name, const Size* histogram) {
+			for (Size index = 0; index < NUM_OF_BUCKETS; index++) {
+				if (!histogram[index]) {
+					continue;
+				}
+
+				csv += name;
+				csv += ",";
+				csv += ::std::to_string(index ? Size(1) << index : 0);
+				csv += ",";
+				csv += ::std::to_string(((Size(1) << index) << 1) - 1);
+				csv += ",";
+				csv += ::std::to_string(histogram[index]);
+				csv += "\n";
+			}
+		};
+
+		append_histogram("size", m_size_histogram);
+		append_histogram("alignment", m_alignment_histogram);
+
+		if (m_is_latency_recorded) {
+			append_histogram("allocate_latency", m_allocate_latency_histogram);
+			append_histogram("reallocate_latency", m_reallocate_latency_histogram);
+			append_histogram("deallocate_latency", m_deallocate_latency_histogram);
+		}
+
+		return csv;
+	}
+
+	template<Bool RecordLatency>
+	FORGE_FORCE_INLINE HistogramStats<RecordLatency>::HistogramStats()
+		: m_counters(),
+		  m_size_histogram(),
+		  m_alignment_histogram(),
+		  m_allocate_latency_histogram(),
+		  m_reallocate_latency_histogram(),
+		  m_deallocate_latency_histogram() {}
+
+	template<Bool RecordLatency>
+	FORGE_FORCE_INLINE Void HistogramStats<RecordLatency>::OnAllocate(VoidPtr address, Size size, Size alignment, Size allocated_size)
+	{
+		m_counters.OnAllocate(address, size, alignment, allocated_size);
+
+		m_size_histogram[GetBucketIndex(size)] += 1;
+		m_alignment_histogram[GetBucketIndex(alignment)] += 1;
+	}
+	template<Bool RecordLatency>
+	FORGE_FORCE_INLINE Void HistogramStats<RecordLatency>::OnCallocate(VoidPtr address, Size size, Byte value, Size alignment, Size allocated_size)
+	{
+		OnAllocate(address, size, alignment, allocated_size);
+	}
+	template<Bool RecordLatency>
+	FORGE_FORCE_INLINE Void HistogramStats<RecordLatency>::OnReallocate(VoidPtr old_address, VoidPtr new_address, Size size, Size alignment, Size old_allocated_size, Size allocated_size)
+	{
+		m_counters.OnReallocate(old_address, new_address, size, alignment, old_allocated_size, allocated_size);
+
+		m_size_histogram[GetBucketIndex(size)] += 1;
+		m_alignment_histogram[GetBucketIndex(alignment)] += 1;
+	}
+	template<Bool RecordLatency>
+	FORGE_FORCE_INLINE Void HistogramStats<RecordLatency>::OnAllocateBatch(const VoidPtr* addresses, Size count, Size size, Size alignment, Size allocated_size)
+	{
+		m_counters.OnAllocateBatch(addresses, count, size, alignment, allocated_size);
+
+		m_size_histogram[GetBucketIndex(size)] += count;
+		m_alignment_histogram[GetBucketIndex(alignment)] += count;
+	}
+	template<Bool RecordLatency>
+	FORGE_FORCE_INLINE Void HistogramStats<RecordLatency>::OnDeallocate(VoidPtr address, Size allocated_size)
+	{
+		m_counters.OnDeallocate(address, allocated_size);
+	}
+	template<Bool RecordLatency>
+	FORGE_FORCE_INLINE Void HistogramStats<RecordLatency>::OnDeallocateBatch(const VoidPtr* addresses, Size count, Size allocated_size)
+	{
+		m_counters.OnDeallocateBatch(addresses, count, allocated_size);
+	}
+	template<Bool RecordLatency>
+	FORGE_FORCE_INLINE Void HistogramStats<RecordLatency>::Reset()
+	{
+		m_counters.Reset();
+
+		::std::memset(m_size_histogram, 0, sizeof(m_size_histogram));
+		::std::memset(m_alignment_histogram, 0, sizeof(m_alignment_histogram));
+		::std::memset(m_allocate_latency_histogram, 0, sizeof(m_allocate_latency_histogram));
+		::std::memset(m_reallocate_latency_histogram, 0, sizeof(m_reallocate_latency_histogram));
+		::std::memset(m_deallocate_latency_histogram, 0, sizeof(m_deallocate_latency_histogram));
+	}
+
+	template<Bool RecordLatency>
+	FORGE_FORCE_INLINE Void HistogramStats<RecordLatency>::OnAllocateLatency(Size cycles)
+	{
+		m_allocate_latency_histogram[GetBucketIndex(cycles)] += 1;
+	}
+	template<Bool RecordLatency>
+	FORGE_FORCE_INLINE Void HistogramStats<RecordLatency>::OnReallocateLatency(Size cycles)
+	{
+		m_reallocate_latency_histogram[GetBucketIndex(cycles)] += 1;
+	}
+	template<Bool RecordLatency>
+	FORGE_FORCE_INLINE Void HistogramStats<RecordLatency>::OnDeallocateLatency(Size cycles)
+	{
+		m_deallocate_latency_histogram[GetBucketIndex(cycles)] += 1;
+	}
+
+	template<Bool RecordLatency>
+	FORGE_FORCE_INLINE Size HistogramStats<RecordLatency>::GetPeakSize() const
+	{
+		return m_counters.GetPeakSize();
+	}
+	template<Bool RecordLatency>
+	FORGE_FORCE_INLINE Size HistogramStats<RecordLatency>::GetTotalSize() const
+	{
+		return m_counters.GetTotalSize();
+	}
+	template<Bool RecordLatency>
+	FORGE_FORCE_INLINE Size HistogramStats<RecordLatency>::GetNumOfAllocations() const
+	{
+		return m_counters.GetNumOfAllocations();
+	}
+	template<Bool RecordLatency>
+	FORGE_FORCE_INLINE Size HistogramStats<RecordLatency>::GetNumOfDeallocations() const
+	{
+		return m_counters.GetNumOfDeallocations();
+	}
+
+	template<Bool RecordLatency>
+	FORGE_FORCE_INLINE HistogramSnapshot HistogramStats<RecordLatency>::Snapshot() const
+	{
+		HistogramSnapshot snapshot;
+
+		snapshot.m_peak_size = m_counters.GetPeakSize();
+		snapshot.m_total_size = m_counters.GetTotalSize();
+		snapshot.m_num_of_allocations = m_counters.GetNumOfAllocations();
+		snapshot.m_num_of_deallocations = m_counters.GetNumOfDeallocations();
+
+		::std::memcpy(snapshot.m_size_histogram, m_size_histogram, sizeof(m_size_histogram));
+		::std::memcpy(snapshot.m_alignment_histogram, m_alignment_histogram, sizeof(m_alignment_histogram));
+
+		snapshot.m_is_latency_recorded = RecordLatency;
+
+		::std::memcpy(snapshot.m_allocate_latency_histogram, m_allocate_latency_histogram, sizeof(m_allocate_latency_histogram));
+		::std::memcpy(snapshot.m_reallocate_latency_histogram, m_reallocate_latency_histogram, sizeof(m_reallocate_latency_histogram));
+		::std::memcpy(snapshot.m_deallocate_latency_histogram, m_deallocate_latency_histogram, sizeof(m_deallocate_latency_histogram));
+
+		return snapshot;
+	}
+
+	template<Bool RecordLatency>
+	FORGE_FORCE_INLINE Size HistogramStats<RecordLatency>::GetBucketIndex(Size value)
+	{
+		return value ? BitScanReverse(value) : 0;
+	}
+}
+
+#endif
@@ -0,0 +1,55 @@
+#ifndef NO_STATS_INL_HPP
+#define NO_STATS_INL_HPP
+
+#include <forge-memory/Stats/NoStats.hpp>
+
+namespace Forge
+{
+	FORGE_FORCE_INLINE Void NoStats::OnAllocate(VoidPtr address, Size size, Size alignment, Size allocated_size)
+	{
+		// Do Nothing
+	}
+	FORGE_FORCE_INLINE Void NoStats::OnCallocate(VoidPtr address, Size size, Byte value, Size alignment, Size allocated_size)
+	{
+		// Do Nothing
+	}
+	FORGE_FORCE_INLINE Void NoStats::OnReallocate(VoidPtr old_address, VoidPtr new_address, Size size, Size alignment, Size old_allocated_size, Size allocated_size)
+	{
+		// Do Nothing
+	}
+	FORGE_FORCE_INLINE Void NoStats::OnAllocateBatch(const VoidPtr* addresses, Size count, Size size, Size alignment, Size allocated_size)
+	{
+		// Do Nothing
+	}
+	FORGE_FORCE_INLINE Void NoStats::OnDeallocate(VoidPtr address, Size allocated_size)
+	{
+		// Do Nothing
+	}
+	FORGE_FORCE_INLINE Void NoStats::OnDeallocateBatch(const VoidPtr* addresses, Size count, Size allocated_size)
+	{
+		// Do Nothing
+	}
+	FORGE_FORCE_INLINE Void NoStats::Reset()
+	{
+		// Do Nothing
+	}
+
+	FORGE_FORCE_INLINE Size NoStats::GetPeakSize() const
+	{
+		return 0;
+	}
+	FORGE_FORCE_INLINE Size NoStats::GetTotalSize() const
+	{
+		return 0;
+	}
+	FORGE_FORCE_INLINE Size NoStats::GetNumOfAllocations() const
+	{
+		return 0;
+	}
+	FORGE_FORCE_INLINE Size NoStats::GetNumOfDeallocations() const
+	{
+		return 0;
+	}
+}
+
+#endif
@@ -0,0 +1,79 @@
+#ifndef SIMPLE_STATS_INL_HPP
+#define SIMPLE_STATS_INL_HPP
+
+#include <forge-memory/Stats/SimpleStats.hpp>
+
+namespace Forge
+{
+	FORGE_FORCE_INLINE SimpleStats::SimpleStats()
+		: m_peak_size(0), m_total_size(0), m_num_of_allocations(0), m_num_of_deallocations(0) {}
+
+	FORGE_FORCE_INLINE Void SimpleStats::OnAllocate(VoidPtr address, Size size, Size alignment, Size allocated_size)
+	{
+		m_total_size += allocated_size;
+		m_num_of_allocations += 1;
+
+		if (m_peak_size < m_total_size) {
+			m_peak_size = m_total_size;
+		}
+	}
+	FORGE_FORCE_INLINE Void SimpleStats::OnCallocate(VoidPtr address, Size size, Byte value, Size alignment, Size allocated_size)
+	{
+		OnAllocate(address, size, alignment, allocated_size);
+	}
+	FORGE_FORCE_INLINE Void SimpleStats::OnReallocate(VoidPtr old_address, VoidPtr new_address, Size size, Size alignment, Size old_allocated_size, Size allocated_size)
+	{
+		m_total_size -= old_allocated_size;
+		m_total_size += allocated_size;
+		m_num_of_allocations += 1;
+
+		if (m_peak_size < m_total_size) {
+			m_peak_size = m_total_size;
+		}
+	}
+	FORGE_FORCE_INLINE Void SimpleStats::OnAllocateBatch(const VoidPtr* addresses, Size count, Size size, Size alignment, Size allocated_size)
+	{
+		m_total_size += allocated_size;
+		m_num_of_allocations += count;
+
+		if (m_peak_size < m_total_size) {
+			m_peak_size = m_total_size;
+		}
+	}
+	FORGE_FORCE_INLINE Void SimpleStats::OnDeallocate(VoidPtr address, Size allocated_size)
+	{
+		m_total_size -= allocated_size;
+		m_num_of_deallocations += 1;
+	}
+	FORGE_FORCE_INLINE Void SimpleStats::OnDeallocateBatch(const VoidPtr* addresses, Size count, Size allocated_size)
+	{
+		m_total_size -= allocated_size;
+		m_num_of_deallocations += count;
+	}
+	FORGE_FORCE_INLINE Void SimpleStats::Reset()
+	{
+		m_peak_size = 0;
+		m_total_size = 0;
+		m_num_of_allocations = 0;
+		m_num_of_deallocations = 0;
+	}
+
+	FORGE_FORCE_INLINE Size SimpleStats::GetPeakSize() const
+	{
+		return m_peak_size;
+	}
+	FORGE_FORCE_INLINE Size SimpleStats::GetTotalSize() const
+	{
+		return m_total_size;
+	}
+	FORGE_FORCE_INLINE Size SimpleStats::GetNumOfAllocations() const
+	{
+		return m_num_of_allocations;
+	}
+	FORGE_FORCE_INLINE Size SimpleStats::GetNumOfDeallocations() const
+	{
+		return m_num_of_deallocations;
+	}
+}
+
+#endif
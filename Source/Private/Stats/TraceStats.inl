@@ -0,0 +1,232 @@
+#ifndef TRACE_STATS_INL_HPP
+#define TRACE_STATS_INL_HPP
+
+#include <cstring>
+
+#include <forge-memory/BitUtilities.hpp>
+#include <forge-memory/CycleCounter.hpp>
+#include <forge-memory/Stats/TraceStats.hpp>
+
+namespace Forge
+{
+	FORGE_FORCE_INLINE TraceStats::TraceStats()
+		: m_id(s_next_id.fetch_add(1, ::std::memory_order_relaxed)), m_counters(), m_file(nullptr), m_is_recording(false) {}
+
+	FORGE_FORCE_INLINE TraceStats::~TraceStats()
+	{
+		Close();
+	}
+
+	FORGE_FORCE_INLINE Bool TraceStats::Open(const char* path)
+	{
+		Close();
+
+		::std::lock_guard<::std::mutex> lock(m_mutex);
+
+		m_file = fopen(path, "wb");
+
+		if (!m_file) {
+			return false;
+		}
+
+		TraceFileHeader header;
+		memcpy(header.m_magic, TRACE_MAGIC, sizeof(TRACE_MAGIC));
+		header.m_version = TRACE_VERSION;
+		header.m_record_size = sizeof(TraceRecord);
+
+		fwrite(&header, sizeof(header), 1, m_file);
+
+		// Records left over from a previous trace file do not belong in this one.
+		for (auto& buffer : m_buffers) {
+			buffer->m_tail.store(buffer->m_head.load(::std::memory_order_acquire), ::std::memory_order_release);
+		}
+
+		m_is_recording.store(true, ::std::memory_order_release);
+
+		return true;
+	}
+	FORGE_FORCE_INLINE Void TraceStats::Close()
+	{
+		::std::lock_guard<::std::mutex> lock(m_mutex);
+
+		m_is_recording.store(false, ::std::memory_order_release);
+
+		if (!m_file) {
+			return;
+		}
+
+		for (auto& buffer : m_buffers) {
+			Drain(buffer.get());
+		}
+
+		fclose(m_file);
+		m_file = nullptr;
+	}
+	FORGE_FORCE_INLINE Void TraceStats::Flush()
+	{
+		::std::lock_guard<::std::mutex> lock(m_mutex);
+
+		for (auto& buffer : m_buffers) {
+			Drain(buffer.get());
+		}
+
+		if (m_file) {
+			fflush(m_file);
+		}
+	}
+	FORGE_FORCE_INLINE Bool TraceStats::IsRecording() const
+	{
+		return m_is_recording.load(::std::memory_order_relaxed);
+	}
+
+	FORGE_FORCE_INLINE Void TraceStats::OnAllocate(VoidPtr address, Size size, Size alignment, Size allocated_size)
+	{
+		m_counters.OnAllocate(address, size, alignment, allocated_size);
+
+		Record(TraceOperation::Allocate, address, nullptr, size, alignment, 0);
+	}
+	FORGE_FORCE_INLINE Void TraceStats::OnCallocate(VoidPtr address, Size size, Byte value, Size alignment, Size allocated_size)
+	{
+		m_counters.OnCallocate(address, size, value, alignment, allocated_size);
+
+		Record(TraceOperation::Callocate, address, nullptr, size, alignment, value);
+	}
+	FORGE_FORCE_INLINE Void TraceStats::OnReallocate(VoidPtr old_address, VoidPtr new_address, Size size, Size alignment, Size old_allocated_size, Size allocated_size)
+	{
+		m_counters.OnReallocate(old_address, new_address, size, alignment, old_allocated_size, allocated_size);
+
+		Record(TraceOperation::Reallocate, new_address, old_address, size, alignment, 0);
+	}
+	FORGE_FORCE_INLINE Void TraceStats::OnAllocateBatch(const VoidPtr* addresses, Size count, Size size, Size alignment, Size allocated_size)
+	{
+		m_counters.OnAllocateBatch(addresses, count, size, alignment, allocated_size);
+
+		// Replaying a trace only knows single operations, so the batch is unrolled.
+		for (Size i = 0; i < count; i++) {
+			Record(TraceOperation::Allocate, addresses[i], nullptr, size, alignment, 0);
+		}
+	}
+	FORGE_FORCE_INLINE Void TraceStats::OnDeallocate(VoidPtr address, Size allocated_size)
+	{
+		m_counters.OnDeallocate(address, allocated_size);
+
+		Record(TraceOperation::Deallocate, address, nullptr, 0, 1, 0);
+	}
+	FORGE_FORCE_INLINE Void TraceStats::OnDeallocateBatch(const VoidPtr* addresses, Size count, Size allocated_size)
+	{
+		m_counters.OnDeallocateBatch(addresses, count, allocated_size);
+
+		for (Size i = 0; i < count; i++) {
+			Record(TraceOperation::Deallocate, addresses[i], nullptr, 0, 1, 0);
+		}
+	}
+	FORGE_FORCE_INLINE Void TraceStats::Reset()
+	{
+		m_counters.Reset();
+
+		Record(TraceOperation::Reset, nullptr, nullptr, 0, 1, 0);
+	}
+
+	FORGE_FORCE_INLINE Size TraceStats::GetPeakSize() const
+	{
+		return m_counters.GetPeakSize();
+	}
+	FORGE_FORCE_INLINE Size TraceStats::GetTotalSize() const
+	{
+		return m_counters.GetTotalSize();
+	}
+	FORGE_FORCE_INLINE Size TraceStats::GetNumOfAllocations() const
+	{
+		return m_counters.GetNumOfAllocations();
+	}
+	FORGE_FORCE_INLINE Size TraceStats::GetNumOfDeallocations() const
+	{
+		return m_counters.GetNumOfDeallocations();
+	}
+
+	FORGE_FORCE_INLINE TraceStats::ThreadBuffer* TraceStats::GetThreadBuffer()
+	{
+		ThreadBufferRegistry& registry = s_registry;
+
+		if (registry.m_last_id == m_id) {
+			return registry.m_last_buffer;
+		}
+
+		ThreadBuffer* thread_buffer = nullptr;
+
+		for (auto& entry : registry.m_buffers) {
+			if (entry.first == m_id) {
+				thread_buffer = entry.second;
+				break;
+			}
+		}
+
+		if (!thread_buffer) {
+			::std::lock_guard<::std::mutex> lock(m_mutex);
+
+			thread_buffer = new ThreadBuffer;
+			thread_buffer->m_head.store(0, ::std::memory_order_relaxed);
+			thread_buffer->m_tail.store(0, ::std::memory_order_relaxed);
+			thread_buffer->m_thread_id = static_cast<::std::uint32_t>(m_buffers.size());
+
+			// The buffer is owned by the recorder, so records of exited threads still get written.
+			m_buffers.emplace_back(thread_buffer);
+			registry.m_buffers.emplace_back(m_id, thread_buffer);
+		}
+
+		registry.m_last_id = m_id;
+		registry.m_last_buffer = thread_buffer;
+
+		return thread_buffer;
+	}
+
+	FORGE_FORCE_INLINE Void TraceStats::Record(TraceOperation operation, VoidPtr address, VoidPtr old_address, Size size, Size alignment, Byte value)
+	{
+		if (!m_is_recording.load(::std::memory_order_acquire)) {
+			return;
+		}
+
+		ThreadBuffer* buffer = GetThreadBuffer();
+
+		Size head = buffer->m_head.load(::std::memory_order_relaxed);
+
+		if (head - buffer->m_tail.load(::std::memory_order_acquire) == BUFFER_CAPACITY) {
+			::std::lock_guard<::std::mutex> lock(m_mutex);
+
+			Drain(buffer);
+		}
+
+		TraceRecord& record = buffer->m_records[head & (BUFFER_CAPACITY - 1)];
+		record.m_timestamp = ReadCycleCounter();
+		record.m_address = reinterpret_cast<Size>(address);
+		record.m_old_address = reinterpret_cast<Size>(old_address);
+		record.m_size = size;
+		record.m_thread_id = buffer->m_thread_id;
+		record.m_operation = operation;
+		record.m_alignment_log2 = static_cast<Byte>(BitScanReverse(alignment));
+		record.m_value = value;
+		record.m_reserved = 0;
+
+		buffer->m_head.store(head + 1, ::std::memory_order_release);
+	}
+
+	FORGE_FORCE_INLINE Void TraceStats::Drain(ThreadBuffer* buffer)
+	{
+		Size head = buffer->m_head.load(::std::memory_order_acquire);
+		Size tail = buffer->m_tail.load(::std::memory_order_relaxed);
+
+		// The ring buffer wraps around at most once, so the records are written in up to two runs.
+		while (m_file && tail != head) {
+			Size index = tail & (BUFFER_CAPACITY - 1);
+			Size count = head - tail < BUFFER_CAPACITY - index ? head - tail : BUFFER_CAPACITY - index;
+
+			fwrite(&buffer->m_records[index], sizeof(TraceRecord), count, m_file);
+
+			tail += count;
+		}
+
+		buffer->m_tail.store(head, ::std::memory_order_release);
+	}
+}
+
+#endif
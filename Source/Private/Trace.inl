@@ -0,0 +1,46 @@
+#ifndef TRACE_INL_HPP
+#define TRACE_INL_HPP
+
+#include <cstdio>
+#include <cstring>
+
+#include <forge-memory/Trace.hpp>
+
+namespace Forge
+{
+	FORGE_FORCE_INLINE Bool ReadTrace(const char* path, ::std::vector<TraceRecord>& records)
+	{
+		FILE* file = fopen(path, "rb");
+
+		if (!file) {
+			return false;
+		}
+
+		TraceFileHeader header;
+
+		Bool is_valid = fread(&header, sizeof(header), 1, file) == 1 &&
+			memcmp(header.m_magic, TRACE_MAGIC, sizeof(TRACE_MAGIC)) == 0 &&
+			header.m_version == TRACE_VERSION &&
+			header.m_record_size == sizeof(TraceRecord);
+
+		if (!is_valid) {
+			fclose(file);
+			return false;
+		}
+
+		records.clear();
+
+		TraceRecord buffer[1024];
+		Size num_of_records;
+
+		while ((num_of_records = fread(buffer, sizeof(TraceRecord), 1024, file)) > 0) {
+			records.insert(records.end(), buffer, buffer + num_of_records);
+		}
+
+		fclose(file);
+
+		return true;
+	}
+}
+
+#endif
@@ -0,0 +1,206 @@
+#ifndef VIRTUAL_MEMORY_INL_HPP
+#define VIRTUAL_MEMORY_INL_HPP
+
+#if defined(_WIN32)
+	#include <windows.h>
+#else
+	#include <stdio.h>
+	#include <string.h>
+	#include <unistd.h>
+	#include <sys/mman.h>
+#endif
+
+#if defined(__linux__)
+	#include <sys/syscall.h>
+#endif
+
+#include <forge-memory/VirtualMemory.hpp>
+
+namespace Forge
+{
+	FORGE_FORCE_INLINE Size VirtualGetPageSize()
+	{
+	#if defined(_WIN32)
+		SYSTEM_INFO system_info;
+		GetSystemInfo(&system_info);
+
+		return static_cast<Size>(system_info.dwPageSize);
+	#else
+		static const Size page_size = static_cast<Size>(sysconf(_SC_PAGESIZE));
+
+		return page_size;
+	#endif
+	}
+
+	FORGE_FORCE_INLINE VoidPtr VirtualReserve(Size size)
+	{
+	#if defined(_WIN32)
+		return VirtualAlloc(nullptr, size, MEM_RESERVE, PAGE_NOACCESS);
+	#else
+		VoidPtr address = mmap(nullptr, size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+
+		return address == MAP_FAILED ? nullptr : address;
+	#endif
+	}
+
+	FORGE_FORCE_INLINE Size VirtualGetHugePageSize()
+	{
+	#if defined(__linux__)
+		return 2 * 1024 * 1024;
+	#else
+		return 0;
+	#endif
+	}
+
+	FORGE_FORCE_INLINE VoidPtr VirtualReserve(Size size, PageBacking page_backing, Bool& is_huge_page_backed)
+	{
+		is_huge_page_backed = false;
+
+	#if defined(__linux__)
+		Size huge_page_size = VirtualGetHugePageSize();
+
+		if (page_backing == PageBacking::ExplicitHuge) {
+			// Without MAP_NORESERVE the mapping fails up front if the huge page pool is too small, instead of faulting later.
+			VoidPtr address = mmap(nullptr, size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+
+			if (address != MAP_FAILED) {
+				is_huge_page_backed = true;
+				return address;
+			}
+
+			page_backing = PageBacking::TransparentHuge;
+		}
+
+		if (page_backing == PageBacking::TransparentHuge) {
+			// Over-reserve so the range can be trimmed to a huge page boundary, transparent huge pages need aligned ranges.
+			Byte* reserved = reinterpret_cast<Byte*>(mmap(nullptr, size + huge_page_size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0));
+
+			if (reserved == MAP_FAILED) {
+				return nullptr;
+			}
+
+			Byte* address = reinterpret_cast<Byte*>((reinterpret_cast<Size>(reserved) + (huge_page_size - 1)) & ~(huge_page_size - 1));
+
+			if (address != reserved) {
+				munmap(reserved, static_cast<Size>(address - reserved));
+			}
+
+			munmap(address + size, static_cast<Size>(reserved + huge_page_size - address));
+
+			is_huge_page_backed = madvise(address, size, MADV_HUGEPAGE) == 0;
+
+			// The advice is accepted even if transparent huge pages are disabled system wide.
+			if (FILE* file = fopen("/sys/kernel/mm/transparent_hugepage/enabled", "r")) {
+				char mode[64] = {};
+
+				if (fgets(mode, sizeof(mode), file) && strstr(mode, "[never]")) {
+					is_huge_page_backed = false;
+				}
+
+				fclose(file);
+			}
+
+			return address;
+		}
+	#endif
+
+		return VirtualReserve(size);
+	}
+
+	FORGE_FORCE_INLINE Bool VirtualCommit(VoidPtr address, Size size)
+	{
+	#if defined(_WIN32)
+		return VirtualAlloc(address, size, MEM_COMMIT, PAGE_READWRITE) != nullptr;
+	#else
+		return mprotect(address, size, PROT_READ | PROT_WRITE) == 0;
+	#endif
+	}
+
+	FORGE_FORCE_INLINE Void VirtualDecommit(VoidPtr address, Size size)
+	{
+	#if defined(_WIN32)
+		VirtualFree(address, size, MEM_DECOMMIT);
+	#else
+		madvise(address, size, MADV_DONTNEED);
+		mprotect(address, size, PROT_NONE);
+	#endif
+	}
+
+	FORGE_FORCE_INLINE Void VirtualRelease(VoidPtr address, Size size)
+	{
+	#if defined(_WIN32)
+		VirtualFree(address, 0, MEM_RELEASE);
+	#else
+		munmap(address, size);
+	#endif
+	}
+
+	FORGE_FORCE_INLINE Size VirtualGetNumOfNodes()
+	{
+	#if defined(__linux__)
+		static const Size num_of_nodes = []() -> Size {
+			FILE* file = fopen("/sys/devices/system/node/possible", "r");
+
+			if (!file) {
+				return 1;
+			}
+
+			// The file holds a node list such as "0" or "0-1", the last number is the highest node index.
+			char nodes[256] = {};
+			Size last_node = 0;
+
+			if (fgets(nodes, sizeof(nodes), file)) {
+				for (char* current = nodes; *current; current++) {
+					if (*current == '-' || *current == ',') {
+						last_node = 0;
+					}
+					else if (*current >= '0' && *current <= '9') {
+						last_node = last_node * 10 + static_cast<Size>(*current - '0');
+					}
+				}
+			}
+
+			fclose(file);
+
+			return last_node + 1;
+		}();
+
+		return num_of_nodes;
+	#else
+		return 1;
+	#endif
+	}
+
+	FORGE_FORCE_INLINE Size VirtualGetCurrentNode()
+	{
+	#if defined(__linux__)
+		unsigned cpu = 0;
+		unsigned node = 0;
+
+		if (syscall(SYS_getcpu, &cpu, &node, nullptr) != 0) {
+			return 0;
+		}
+
+		return static_cast<Size>(node);
+	#else
+		return 0;
+	#endif
+	}
+
+	FORGE_FORCE_INLINE Bool VirtualBindToNode(VoidPtr address, Size size, Size node)
+	{
+	#if defined(__linux__)
+		// MPOL_PREFERRED from <numaif.h>, spelled out to avoid depending on libnuma.
+		constexpr int mpol_preferred = 1;
+
+		unsigned long node_mask = 1ul << node;
+
+		// The kernel drops the last bit of the mask, so one more bit than the mask holds is passed.
+		return syscall(SYS_mbind, address, size, mpol_preferred, &node_mask, sizeof(node_mask) * 8 + 1, 0) == 0;
+	#else
+		return false;
+	#endif
+	}
+}
+
+#endif
@@ -5,6 +5,12 @@
 
 #include "Policies/IAllocationPolicy.hpp"
 
+#include "Stats/NoStats.hpp"
+#include "Stats/SimpleStats.hpp"
+#include "Stats/ConcurrentStats.hpp"
+#include "Stats/HistogramStats.hpp"
+#include "Stats/TraceStats.hpp"
+
 #include <forge-base/Core/Types.hpp>
 #include <forge-base/Core/System.hpp>
 
@@ -16,22 +22,15 @@ namespace Forge {
 	 * according to a specific memory policy.
 	 *
 	 * @tparam AllocationPolicy The type of memory allocation policy to use.
+	 * @tparam AllocationStats The type of statistics policy to record allocations with, one of NoStats, SimpleStats, ConcurrentStats, HistogramStats or TraceStats.
 	 */
-	template<typename AllocationPolicy>
+	template<typename AllocationPolicy, typename AllocationStats = SimpleStats>
 	class Allocator
 	{
-	private:
-		struct AllocationStats
-		{
-			Size m_peak_size;
-			Size m_total_size;
-			Size m_num_of_allocations;
-			Size m_num_of_deallocations;
-		};
+		static_assert(IsAllocationPolicy<AllocationPolicy>::value, "AllocationPolicy does not satisfy the memory policy contract of IAllocationPolicy");
 
 	private:
-		Size  m_capacity;
-		Float32 m_used_space;
+		Size m_capacity;
 
 	private:
 		AllocationStats  m_allocation_stats;
@@ -48,10 +47,35 @@ namespace Forge {
 		/**
 		 * @brief Gets the currently used space of the allocator.
 		 *
+		 * Computed on read from the total size, so it costs nothing on the allocation path.
+		 *
 		 * @return Float32 storing the currently used space of the allocator as a perecentage.
 		 */
 		Float32 GetUsedSpace();
 
+		/**
+		 * @brief Gets the memory policy used by the allocator.
+		 *
+		 * Gives access to policy specific functionalities such as stack markers.
+		 *
+		 * @return AllocationPolicy& storing the memory policy used by the allocator.
+		 */
+		AllocationPolicy& GetAllocationPolicy();
+
+		/**
+		 * @brief Gets the statistics policy used by the allocator.
+		 *
+		 * @return AllocationStats& storing the statistics policy used by the allocator.
+		 */
+		AllocationStats& GetAllocationStats();
+
+		/**
+		 * @brief Checks whether the memory pool used by the allocator actually got backed by huge pages.
+		 *
+		 * @return True if the memory pool is backed by huge pages, otherwise false.
+		 */
+		Bool IsHugePageBacked();
+
 	public:
 		/**
 		 * @brief Gets the peak size allocated during lifetime of the allocator.
@@ -61,7 +85,9 @@ namespace Forge {
 		Size GetPeakSize();
 
 		/**
-		 * @brief Gets the total size allocated during lifetime of the allocator.
+		 * @brief Gets the total size of the memory blocks currently allocated by the allocator.
+		 *
+		 * Counts the usable size of every live memory block, which may exceed its requested size.
 		 *
 		 * @return Size storing total size allocated by the allocator in bytes.
 		 */
@@ -85,7 +111,9 @@ namespace Forge {
 		/**
 		 * @brief Gets the allocated size of the specified address.
 		 *
-		 * @return Size storing the allocated size of the specified address in bytes.
+		 * @param[in] address The address of the memory block.
+		 *
+		 * @return Size storing the usable size of the memory block in bytes, or zero if the memory policy does not track block sizes.
 		 */
 		Size GetAllocatedSize(VoidPtr address);
 
@@ -135,6 +163,32 @@ namespace Forge {
 		 */
 		VoidPtr Reallocate(VoidPtr address, Size size, Size alignment = 4);
 
+		/**
+		 * @brief Allocates a number of memory blocks with the same size and alignment using the defined memory policy.
+		 *
+		 * The request is validated and recorded once for the whole batch, so it is cheaper than calling Allocate count times.
+		 *
+		 * @param[in]  size      The size of each memory block to allocate in bytes.
+		 * @param[in]  alignment The alignment requirement for each memory block. Must be a power of two.
+		 * @param[in]  count     The number of memory blocks to allocate.
+		 * @param[out] addresses The array receiving the address of each allocated memory block. Must hold count entries.
+		 *
+		 * @return Size storing the number of memory blocks allocated, stored in the first entries of addresses.
+		 */
+		Size AllocateBatch(Size size, Size alignment, Size count, VoidPtr* addresses);
+
+		/**
+		 * @brief Allocates a block of memory of at least the specified size using the defined memory policy.
+		 *
+		 * The whole usable size reported may be written to, and passed to the sized Deallocate.
+		 *
+		 * @param[in] size      The minimum size of the memory block to allocate in bytes.
+		 * @param[in] alignment The alignment requirement for the memory block. Must be a power of two.
+		 *
+		 * @return AllocationResult storing the address of the allocated memory block and its usable size.
+		 */
+		AllocationResult AllocateAtLeast(Size size, Size alignment = 4);
+
 	public:
 		/**
 		 * @brief Deallocates a block of memory with the specified address using the defined memory policy.
@@ -143,6 +197,27 @@ namespace Forge {
 		 */
 		Void Deallocate(VoidPtr address);
 
+		/**
+		 * @brief Deallocates a block of memory whose size and alignment are known to the caller using the defined memory policy.
+		 *
+		 * Spares the memory policy from looking up the size of the memory block, which most of them store out of line.
+		 *
+		 * @param[in] address   The address of the memory block to deallocate.
+		 * @param[in] size      The size the memory block was last allocated or reallocated with, or any size up to the usable size reported by AllocateAtLeast.
+		 * @param[in] alignment The alignment the memory block was last allocated or reallocated with.
+		 */
+		Void Deallocate(VoidPtr address, Size size, Size alignment = 4);
+
+		/**
+		 * @brief Deallocates a number of memory blocks using the defined memory policy.
+		 *
+		 * The deallocations are recorded once for the whole batch, so it is cheaper than calling Deallocate count times.
+		 *
+		 * @param[in] addresses The array storing the address of each memory block to deallocate. Must not contain null entries.
+		 * @param[in] count     The number of memory blocks to deallocate.
+		 */
+		Void DeallocateBatch(VoidPtr* addresses, Size count);
+
 	public:
 		/**
 		 * @brief Constructs an object of type InType using the defined memory policy.
@@ -194,10 +269,25 @@ namespace Forge {
 		Void DestructArray(InType* address, Size count);
 
 	public:
+		/**
+		 * @brief Releases every memory block allocated after the specified marker was taken from a stack memory policy.
+		 *
+		 * Pops the released memory blocks one by one while statistics are enabled, so each of them is recorded.
+		 *
+		 * @tparam InMarker The type of marker of the memory policy.
+		 *
+		 * @param[in] marker The marker to roll the stack back to.
+		 */
+		template<typename InMarker>
+		Void FreeToMarker(const InMarker& marker);
+
 		/**
 		 * @brief Resets the entire memory pool used by the allocator.
 		 */
 		Void Reset();
+
+	private:
+		Size GetAccountedSize(VoidPtr address, Size size);
 	};
 
 }
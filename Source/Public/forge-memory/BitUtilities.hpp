@@ -0,0 +1,47 @@
+#ifndef BIT_UTILITIES_HPP
+#define BIT_UTILITIES_HPP
+
+#include <forge-base/Core/Types.hpp>
+#include <forge-base/Core/System.hpp>
+
+namespace Forge {
+	/**
+	 * @brief Finds the index of the least significant set bit of the specified value.
+	 *
+	 * @param[in] value The value to scan. Must not be zero.
+	 *
+	 * @returns Size storing the index of the least significant set bit.
+	 */
+	Size BitScanForward(Size value);
+
+	/**
+	 * @brief Finds the index of the most significant set bit of the specified value.
+	 *
+	 * @param[in] value The value to scan. Must not be zero.
+	 *
+	 * @returns Size storing the index of the most significant set bit.
+	 */
+	Size BitScanReverse(Size value);
+
+	/**
+	 * @brief Checks whether the specified value is a power of two.
+	 *
+	 * @param[in] value The value to check.
+	 *
+	 * @returns True if the value is a non-zero power of two, otherwise false.
+	 */
+	constexpr Bool IsPowerOfTwo(Size value);
+
+	/**
+	 * @brief Rounds the specified value up to the next power of two.
+	 *
+	 * @param[in] value The value to round up.
+	 *
+	 * @returns Size storing the smallest power of two greater than or equal to the value.
+	 */
+	constexpr Size NextPowerOfTwo(Size value);
+}
+
+#include "../Private/BitUtilities.inl"
+
+#endif
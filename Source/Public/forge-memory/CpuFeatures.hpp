@@ -0,0 +1,33 @@
+#ifndef CPU_FEATURES_HPP
+#define CPU_FEATURES_HPP
+
+#include <forge-base/Core/Types.hpp>
+#include <forge-base/Core/System.hpp>
+
+namespace Forge {
+	/**
+	 * @brief Stores the vector instruction sets usable on the running processor.
+	 *
+	 * An instruction set only counts as usable if the operating system also saves
+	 * its registers on context switches. Every flag is false on non-x86 processors.
+	 */
+	struct CpuFeatures
+	{
+		Bool m_has_sse2;
+		Bool m_has_avx2;
+		Bool m_has_avx512;
+	};
+
+	/**
+	 * @brief Gets the vector instruction sets usable on the running processor.
+	 *
+	 * The processor is queried through CPUID once, on the first call.
+	 *
+	 * @returns const CpuFeatures& storing the usable vector instruction sets.
+	 */
+	const CpuFeatures& GetCpuFeatures();
+}
+
+#include "../Private/CpuFeatures.inl"
+
+#endif
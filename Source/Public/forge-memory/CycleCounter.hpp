@@ -0,0 +1,22 @@
+#ifndef CYCLE_COUNTER_HPP
+#define CYCLE_COUNTER_HPP
+
+#include <forge-base/Core/Types.hpp>
+#include <forge-base/Core/System.hpp>
+
+namespace Forge {
+	/**
+	 * @brief Reads a cheap, monotonically increasing cycle counter.
+	 *
+	 * Reads the time stamp counter on x86, the virtual counter on ARM64 and falls back
+	 * to a steady clock in nanoseconds elsewhere. Only differences between two reads
+	 * on the same thread are meaningful.
+	 *
+	 * @returns Size storing the current value of the cycle counter.
+	 */
+	Size ReadCycleCounter();
+}
+
+#include "../Private/CycleCounter.inl"
+
+#endif
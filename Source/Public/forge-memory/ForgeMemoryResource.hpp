@@ -0,0 +1,54 @@
+#ifndef FORGE_MEMORY_RESOURCE_HPP
+#define FORGE_MEMORY_RESOURCE_HPP
+
+#include <cstddef>
+#include <memory_resource>
+
+#include "Allocator.hpp"
+
+namespace Forge {
+	/**
+	 * @brief This class exposes an allocator as a polymorphic memory resource, so
+	 * std::pmr containers can allocate through any memory policy.
+	 *
+	 * The memory resource does not own the allocator, which must outlive every
+	 * container using it. It is only thread safe if the memory policy and the
+	 * statistics policy of the allocator are. Exhaustion is reported by throwing
+	 * std::bad_alloc, as required by std::pmr::memory_resource.
+	 *
+	 * @tparam AllocationPolicy The type of memory allocation policy of the allocator.
+	 * @tparam AllocationStats The type of statistics policy of the allocator.
+	 */
+	template<typename AllocationPolicy, typename AllocationStats = SimpleStats>
+	class ForgeMemoryResource final : public ::std::pmr::memory_resource
+	{
+	private:
+		Allocator<AllocationPolicy, AllocationStats>* m_allocator;
+
+	public:
+		/**
+		 * @brief Constructs a memory resource allocating through the specified allocator.
+		 *
+		 * @param[in] allocator The allocator to allocate through. Must outlive the memory resource.
+		 */
+		explicit ForgeMemoryResource(Allocator<AllocationPolicy, AllocationStats>& allocator);
+
+	public:
+		/**
+		 * @brief Gets the allocator used by the memory resource.
+		 *
+		 * @return Allocator& storing the allocator used by the memory resource.
+		 */
+		Allocator<AllocationPolicy, AllocationStats>& GetAllocator() const;
+
+	private:
+		// Overrides spell out the standard types, which the forge-base aliases are not guaranteed to match.
+		void* do_allocate(::std::size_t size, ::std::size_t alignment) override;
+		void  do_deallocate(void* address, ::std::size_t size, ::std::size_t alignment) override;
+		bool  do_is_equal(const ::std::pmr::memory_resource& other) const noexcept override;
+	};
+}
+
+#include "../Private/ForgeMemoryResource.inl"
+
+#endif
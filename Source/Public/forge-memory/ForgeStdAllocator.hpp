@@ -0,0 +1,103 @@
+#ifndef FORGE_STD_ALLOCATOR_HPP
+#define FORGE_STD_ALLOCATOR_HPP
+
+#include <cstddef>
+#include <type_traits>
+
+#include "Allocator.hpp"
+
+namespace Forge {
+	/**
+	 * @brief This class adapts an allocator to the standard allocator requirements,
+	 * so standard containers can allocate through any memory policy.
+	 *
+	 * Copies refer to the same allocator, which must outlive every container using
+	 * it. The allocator follows containers on copy and move assignment and on swap,
+	 * so memory blocks are always returned to the allocator they came from. Only
+	 * thread safe if the memory policy and the statistics policy of the allocator
+	 * are. Exhaustion is reported by throwing std::bad_alloc, as required by the
+	 * standard containers.
+	 *
+	 * @tparam InType The type of object to allocate.
+	 * @tparam AllocationPolicy The type of memory allocation policy of the allocator.
+	 * @tparam AllocationStats The type of statistics policy of the allocator.
+	 */
+	template<typename InType, typename AllocationPolicy, typename AllocationStats = SimpleStats>
+	class ForgeStdAllocator
+	{
+		template<typename, typename, typename>
+		friend class ForgeStdAllocator;
+
+	public:
+		using value_type = InType;
+
+		using propagate_on_container_copy_assignment = ::std::true_type;
+		using propagate_on_container_move_assignment = ::std::true_type;
+		using propagate_on_container_swap = ::std::true_type;
+		using is_always_equal = ::std::false_type;
+
+		template<typename OtherType>
+		struct rebind
+		{
+			using other = ForgeStdAllocator<OtherType, AllocationPolicy, AllocationStats>;
+		};
+
+	private:
+		Allocator<AllocationPolicy, AllocationStats>* m_allocator;
+
+	public:
+		/**
+		 * @brief Constructs a standard allocator allocating through the specified allocator.
+		 *
+		 * @param[in] allocator The allocator to allocate through. Must outlive every container using it.
+		 */
+		ForgeStdAllocator(Allocator<AllocationPolicy, AllocationStats>& allocator) noexcept;
+
+		/**
+		 * @brief Constructs a standard allocator for InType referring to the same allocator as the specified one.
+		 *
+		 * @param[in] other The standard allocator for another type to copy the allocator of.
+		 */
+		template<typename OtherType>
+		ForgeStdAllocator(const ForgeStdAllocator<OtherType, AllocationPolicy, AllocationStats>& other) noexcept;
+
+	public:
+		/**
+		 * @brief Gets the allocator used by the standard allocator.
+		 *
+		 * @return Allocator& storing the allocator used by the standard allocator.
+		 */
+		Allocator<AllocationPolicy, AllocationStats>& GetAllocator() const noexcept;
+
+	public:
+		/**
+		 * @brief Allocates uninitialized storage for the specified number of objects of type InType.
+		 *
+		 * @param[in] count The number of objects to allocate storage for.
+		 *
+		 * @return InType* storing the address of the allocated storage.
+		 */
+		InType* allocate(::std::size_t count);
+
+		/**
+		 * @brief Deallocates storage previously allocated for the specified number of objects of type InType.
+		 *
+		 * The size is passed on, so the memory policy does not have to look it up.
+		 *
+		 * @param[in] address The address of the storage to deallocate.
+		 * @param[in] count   The number of objects the storage was allocated for.
+		 */
+		void deallocate(InType* address, ::std::size_t count);
+
+	public:
+		template<typename OtherType>
+		bool operator==(const ForgeStdAllocator<OtherType, AllocationPolicy, AllocationStats>& other) const noexcept;
+
+		template<typename OtherType>
+		bool operator!=(const ForgeStdAllocator<OtherType, AllocationPolicy, AllocationStats>& other) const noexcept;
+	};
+}
+
+#include "../Private/ForgeStdAllocator.inl"
+
+#endif
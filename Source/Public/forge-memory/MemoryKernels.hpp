@@ -0,0 +1,263 @@
+#ifndef MEMORY_KERNELS_HPP
+#define MEMORY_KERNELS_HPP
+
+#include <forge-base/Core/Types.hpp>
+#include <forge-base/Core/System.hpp>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+	#define FORGE_MEMORY_X86_KERNELS
+#endif
+
+// Lets a single translation unit hold kernels for instruction sets it is not compiled for, they are only called after checking CPUID.
+#if defined(__GNUC__) || defined(__clang__)
+	#define FORGE_MEMORY_TARGET(instruction_sets) __attribute__((target(instruction_sets)))
+#else
+	#define FORGE_MEMORY_TARGET(instruction_sets)
+#endif
+
+namespace Forge {
+	// How far ahead of the copy the streaming kernels prefetch the source.
+	constexpr Size STREAMING_PREFETCH_DISTANCE = 1024;
+
+	/**
+	 * @brief Stores the memory kernels selected for the running processor.
+	 */
+	struct MemoryKernels
+	{
+		Void (*m_copy)(VoidPtr destination, ConstVoidPtr source, Size size);
+		Void (*m_set)(VoidPtr destination, Byte value, Size size);
+		Bool (*m_compare)(ConstVoidPtr self, ConstVoidPtr other, Size size);
+
+		Void (*m_copy_streaming)(VoidPtr destination, ConstVoidPtr source, Size size);
+		Void (*m_set_streaming)(VoidPtr destination, Byte value, Size size);
+
+		const char* m_name;
+	};
+
+	/**
+	 * @brief Gets the fastest memory kernels usable on the running processor.
+	 *
+	 * The kernels are selected once, on the first call, from the instruction sets reported by GetCpuFeatures.
+	 *
+	 * @returns const MemoryKernels& storing the selected memory kernels.
+	 */
+	const MemoryKernels& GetMemoryKernels();
+
+	/**
+	 * @brief Copies a memory block using the copy of the C library.
+	 *
+	 * @param[out] destination The memory block where data will be copied to.
+	 * @param[in]  source The memory block where data will be copied from. Must not overlap the destination.
+	 * @param[in]  size The number of bytes to copy.
+	 */
+	Void MemoryCopyGeneric(VoidPtr destination, ConstVoidPtr source, Size size);
+
+	/**
+	 * @brief Sets a memory block using the set of the C library.
+	 *
+	 * @param[out] destination The memory block where data will be set.
+	 * @param[in]  value The value to set each byte of the memory block to.
+	 * @param[in]  size The number of bytes to set.
+	 */
+	Void MemorySetGeneric(VoidPtr destination, Byte value, Size size);
+
+	/**
+	 * @brief Compares two memory blocks for equality using the compare of the C library.
+	 *
+	 * @param[in] self The first memory block to compare.
+	 * @param[in] other The second memory block to compare.
+	 * @param[in] size The number of bytes to compare.
+	 *
+	 * @returns True if the memory blocks are equal, otherwise false.
+	 */
+	Bool MemoryCompareGeneric(ConstVoidPtr self, ConstVoidPtr other, Size size);
+
+	/**
+	 * @brief Copies a memory block using the copy of the C library, which has no portable way to bypass the cache.
+	 *
+	 * @param[out] destination The memory block where data will be copied to.
+	 * @param[in]  source The memory block where data will be copied from. Must not overlap the destination.
+	 * @param[in]  size The number of bytes to copy.
+	 */
+	Void MemoryCopyStreamingGeneric(VoidPtr destination, ConstVoidPtr source, Size size);
+
+	/**
+	 * @brief Sets a memory block using the set of the C library, which has no portable way to bypass the cache.
+	 *
+	 * @param[out] destination The memory block where data will be set.
+	 * @param[in]  value The value to set each byte of the memory block to.
+	 * @param[in]  size The number of bytes to set.
+	 */
+	Void MemorySetStreamingGeneric(VoidPtr destination, Byte value, Size size);
+
+#if defined(FORGE_MEMORY_X86_KERNELS)
+	/**
+	 * @brief Copies a memory block with 16 byte SSE2 moves, storing to aligned addresses.
+	 *
+	 * @param[out] destination The memory block where data will be copied to.
+	 * @param[in]  source The memory block where data will be copied from. Must not overlap the destination.
+	 * @param[in]  size The number of bytes to copy.
+	 */
+	FORGE_MEMORY_TARGET("sse2") Void MemoryCopySse2(VoidPtr destination, ConstVoidPtr source, Size size);
+
+	/**
+	 * @brief Copies a memory block with 32 byte AVX2 moves, storing to aligned addresses.
+	 *
+	 * Only call it if GetCpuFeatures reports AVX2.
+	 *
+	 * @param[out] destination The memory block where data will be copied to.
+	 * @param[in]  source The memory block where data will be copied from. Must not overlap the destination.
+	 * @param[in]  size The number of bytes to copy.
+	 */
+	FORGE_MEMORY_TARGET("avx2") Void MemoryCopyAvx2(VoidPtr destination, ConstVoidPtr source, Size size);
+
+	/**
+	 * @brief Copies a memory block with 64 byte AVX-512 moves, using masked moves for the ends.
+	 *
+	 * Only call it if GetCpuFeatures reports AVX-512.
+	 *
+	 * @param[out] destination The memory block where data will be copied to.
+	 * @param[in]  source The memory block where data will be copied from. Must not overlap the destination.
+	 * @param[in]  size The number of bytes to copy.
+	 */
+	FORGE_MEMORY_TARGET("avx512f,avx512bw") Void MemoryCopyAvx512(VoidPtr destination, ConstVoidPtr source, Size size);
+
+	/**
+	 * @brief Sets a memory block with 16 byte SSE2 stores to aligned addresses.
+	 *
+	 * @param[out] destination The memory block where data will be set.
+	 * @param[in]  value The value to set each byte of the memory block to.
+	 * @param[in]  size The number of bytes to set.
+	 */
+	FORGE_MEMORY_TARGET("sse2") Void MemorySetSse2(VoidPtr destination, Byte value, Size size);
+
+	/**
+	 * @brief Sets a memory block with 32 byte AVX2 stores to aligned addresses.
+	 *
+	 * Only call it if GetCpuFeatures reports AVX2.
+	 *
+	 * @param[out] destination The memory block where data will be set.
+	 * @param[in]  value The value to set each byte of the memory block to.
+	 * @param[in]  size The number of bytes to set.
+	 */
+	FORGE_MEMORY_TARGET("avx2") Void MemorySetAvx2(VoidPtr destination, Byte value, Size size);
+
+	/**
+	 * @brief Sets a memory block with 64 byte AVX-512 stores, using masked stores for the ends.
+	 *
+	 * Only call it if GetCpuFeatures reports AVX-512.
+	 *
+	 * @param[out] destination The memory block where data will be set.
+	 * @param[in]  value The value to set each byte of the memory block to.
+	 * @param[in]  size The number of bytes to set.
+	 */
+	FORGE_MEMORY_TARGET("avx512f,avx512bw") Void MemorySetAvx512(VoidPtr destination, Byte value, Size size);
+
+	/**
+	 * @brief Compares two memory blocks for equality 16 bytes at a time with SSE2.
+	 *
+	 * @param[in] self The first memory block to compare.
+	 * @param[in] other The second memory block to compare.
+	 * @param[in] size The number of bytes to compare.
+	 *
+	 * @returns True if the memory blocks are equal, otherwise false.
+	 */
+	FORGE_MEMORY_TARGET("sse2") Bool MemoryCompareSse2(ConstVoidPtr self, ConstVoidPtr other, Size size);
+
+	/**
+	 * @brief Compares two memory blocks for equality 32 bytes at a time with AVX2.
+	 *
+	 * Only call it if GetCpuFeatures reports AVX2.
+	 *
+	 * @param[in] self The first memory block to compare.
+	 * @param[in] other The second memory block to compare.
+	 * @param[in] size The number of bytes to compare.
+	 *
+	 * @returns True if the memory blocks are equal, otherwise false.
+	 */
+	FORGE_MEMORY_TARGET("avx2") Bool MemoryCompareAvx2(ConstVoidPtr self, ConstVoidPtr other, Size size);
+
+	/**
+	 * @brief Compares two memory blocks for equality 64 bytes at a time with AVX-512, using masked loads for the end.
+	 *
+	 * Only call it if GetCpuFeatures reports AVX-512.
+	 *
+	 * @param[in] self The first memory block to compare.
+	 * @param[in] other The second memory block to compare.
+	 * @param[in] size The number of bytes to compare.
+	 *
+	 * @returns True if the memory blocks are equal, otherwise false.
+	 */
+	FORGE_MEMORY_TARGET("avx512f,avx512bw") Bool MemoryCompareAvx512(ConstVoidPtr self, ConstVoidPtr other, Size size);
+
+	/**
+	 * @brief Copies a memory block with 16 byte SSE2 non-temporal stores, prefetching the source ahead of the copy.
+	 *
+	 * The destination bypasses the cache, so copying a large block does not evict the working set.
+	 *
+	 * @param[out] destination The memory block where data will be copied to.
+	 * @param[in]  source The memory block where data will be copied from. Must not overlap the destination.
+	 * @param[in]  size The number of bytes to copy.
+	 */
+	FORGE_MEMORY_TARGET("sse2") Void MemoryCopyStreamingSse2(VoidPtr destination, ConstVoidPtr source, Size size);
+
+	/**
+	 * @brief Copies a memory block with 32 byte AVX2 non-temporal stores, prefetching the source ahead of the copy.
+	 *
+	 * Only call it if GetCpuFeatures reports AVX2.
+	 *
+	 * @param[out] destination The memory block where data will be copied to.
+	 * @param[in]  source The memory block where data will be copied from. Must not overlap the destination.
+	 * @param[in]  size The number of bytes to copy.
+	 */
+	FORGE_MEMORY_TARGET("avx2") Void MemoryCopyStreamingAvx2(VoidPtr destination, ConstVoidPtr source, Size size);
+
+	/**
+	 * @brief Copies a memory block with 64 byte AVX-512 non-temporal stores, prefetching the source ahead of the copy.
+	 *
+	 * Only call it if GetCpuFeatures reports AVX-512.
+	 *
+	 * @param[out] destination The memory block where data will be copied to.
+	 * @param[in]  source The memory block where data will be copied from. Must not overlap the destination.
+	 * @param[in]  size The number of bytes to copy.
+	 */
+	FORGE_MEMORY_TARGET("avx512f,avx512bw") Void MemoryCopyStreamingAvx512(VoidPtr destination, ConstVoidPtr source, Size size);
+
+	/**
+	 * @brief Sets a memory block with 16 byte SSE2 non-temporal stores.
+	 *
+	 * The destination bypasses the cache, so setting a large block does not evict the working set.
+	 *
+	 * @param[out] destination The memory block where data will be set.
+	 * @param[in]  value The value to set each byte of the memory block to.
+	 * @param[in]  size The number of bytes to set.
+	 */
+	FORGE_MEMORY_TARGET("sse2") Void MemorySetStreamingSse2(VoidPtr destination, Byte value, Size size);
+
+	/**
+	 * @brief Sets a memory block with 32 byte AVX2 non-temporal stores.
+	 *
+	 * Only call it if GetCpuFeatures reports AVX2.
+	 *
+	 * @param[out] destination The memory block where data will be set.
+	 * @param[in]  value The value to set each byte of the memory block to.
+	 * @param[in]  size The number of bytes to set.
+	 */
+	FORGE_MEMORY_TARGET("avx2") Void MemorySetStreamingAvx2(VoidPtr destination, Byte value, Size size);
+
+	/**
+	 * @brief Sets a memory block with 64 byte AVX-512 non-temporal stores.
+	 *
+	 * Only call it if GetCpuFeatures reports AVX-512.
+	 *
+	 * @param[out] destination The memory block where data will be set.
+	 * @param[in]  value The value to set each byte of the memory block to.
+	 * @param[in]  size The number of bytes to set.
+	 */
+	FORGE_MEMORY_TARGET("avx512f,avx512bw") Void MemorySetStreamingAvx512(VoidPtr destination, Byte value, Size size);
+#endif
+}
+
+#include "../Private/MemoryKernels.inl"
+
+#endif
@@ -0,0 +1,159 @@
+#ifndef MEMORY_STREAMING_HPP
+#define MEMORY_STREAMING_HPP
+
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <condition_variable>
+
+#include <forge-base/Core/Types.hpp>
+#include <forge-base/Core/System.hpp>
+
+namespace Forge {
+	// Blocks from this size up bypass the cache, smaller ones are handled like MemoryCopy and MemorySet do.
+	constexpr Size DEFAULT_STREAMING_THRESHOLD = 4 * 1024 * 1024;
+
+	// Blocks from this size up are split across the worker threads.
+	constexpr Size DEFAULT_PARALLEL_THRESHOLD = 32 * 1024 * 1024;
+
+	// A few threads already saturate the memory bandwidth, more only add contention.
+	constexpr Size DEFAULT_MAX_NUM_OF_STREAMING_THREADS = 4;
+
+	/**
+	 * @brief Stores when the streaming memory functions bypass the cache and when they split the work across threads.
+	 */
+	struct StreamingSettings
+	{
+		Size m_streaming_threshold;
+		Size m_parallel_threshold;
+
+		// Counts the calling thread, so one runs everything on the calling thread.
+		Size m_max_num_of_threads;
+	};
+
+	/**
+	 * @brief A small pool of worker threads the streaming memory functions split large blocks across.
+	 *
+	 * The threads are started on the first parallel run and live until the program exits.
+	 * The calling thread always works on the parts as well, so a run completes even if no
+	 * thread could be started. Runs are not queued, a run started while another is in progress
+	 * is executed on its calling thread alone.
+	 */
+	class StreamingWorkerPool
+	{
+	public:
+		using Task = Void (*)(VoidPtr context, Size part_index, Size num_of_parts);
+
+	private:
+		::std::mutex              m_run_mutex;
+		::std::mutex              m_mutex;
+		::std::condition_variable m_work_condition;
+		::std::condition_variable m_done_condition;
+
+		::std::vector<::std::thread> m_workers;
+
+		Task    m_task;
+		VoidPtr m_context;
+		Size    m_num_of_parts;
+		Size    m_next_part;
+		Size    m_num_of_pending_parts;
+		Size    m_generation;
+		Bool    m_is_stopping;
+
+		::std::atomic<Size> m_streaming_threshold;
+		::std::atomic<Size> m_parallel_threshold;
+		::std::atomic<Size> m_max_num_of_threads;
+
+	public:
+		StreamingWorkerPool();
+		~StreamingWorkerPool();
+
+	public:
+		StreamingWorkerPool(const StreamingWorkerPool&) = delete;
+		StreamingWorkerPool& operator=(const StreamingWorkerPool&) = delete;
+
+	public:
+		/**
+		 * @brief Gets the worker pool shared by the streaming memory functions.
+		 *
+		 * @return StreamingWorkerPool& the shared worker pool.
+		 */
+		static StreamingWorkerPool& Get();
+
+	public:
+		/**
+		 * @brief Gets the current streaming settings.
+		 *
+		 * @return StreamingSettings the current streaming settings.
+		 */
+		StreamingSettings GetSettings() const;
+
+		/**
+		 * @brief Replaces the streaming settings, calls already running keep the settings they started with.
+		 *
+		 * @param[in] settings The new streaming settings.
+		 */
+		Void SetSettings(const StreamingSettings& settings);
+
+		/**
+		 * @brief Runs a task once for every part, spread across the calling thread and the worker threads.
+		 *
+		 * Returns once every part has completed.
+		 *
+		 * @param[in] num_of_parts The number of parts to run the task for.
+		 * @param[in] task         The task to run for every part.
+		 * @param[in] context      The context passed to every run of the task.
+		 */
+		Void Run(Size num_of_parts, Task task, VoidPtr context);
+
+	private:
+		Void StartWorkers(Size num_of_workers, Size generation);
+		Void RunParts(::std::unique_lock<::std::mutex>& lock);
+		Void WorkerMain(Size generation);
+	};
+
+	/**
+	 * @brief Gets the current streaming settings.
+	 *
+	 * @return StreamingSettings the current streaming settings.
+	 */
+	StreamingSettings GetStreamingSettings();
+
+	/**
+	 * @brief Replaces the streaming settings used by MemoryCopyStreaming and MemorySetStreaming.
+	 *
+	 * @param[in] settings The new streaming settings.
+	 */
+	Void SetStreamingSettings(const StreamingSettings& settings);
+
+	/**
+	 * @brief Copies a large memory block without evicting the working set from the cache.
+	 *
+	 * Blocks from the streaming threshold up are copied with non-temporal stores while
+	 * prefetching the source, and from the parallel threshold up the copy is split across
+	 * the streaming worker pool. Smaller blocks are copied by MemoryCopy.
+	 *
+	 * @param[out] destination The memory block where data will be copied to.
+	 * @param[in]  source The memory block where data will be copied from. Must not overlap the destination.
+	 * @param[in]  size The number of bytes to copy.
+	 */
+	Void MemoryCopyStreaming(VoidPtr destination, ConstVoidPtr source, Size size);
+
+	/**
+	 * @brief Sets a large memory block without evicting the working set from the cache.
+	 *
+	 * Blocks from the streaming threshold up are set with non-temporal stores, and from the
+	 * parallel threshold up the work is split across the streaming worker pool. Smaller
+	 * blocks are set by MemorySet.
+	 *
+	 * @param[out] destination The memory block where data will be set.
+	 * @param[in]  value The value to set each byte of the memory block to.
+	 * @param[in]  size The number of bytes to set.
+	 */
+	Void MemorySetStreaming(VoidPtr destination, Byte value, Size size);
+}
+
+#include "../Private/MemoryStreaming.inl"
+
+#endif
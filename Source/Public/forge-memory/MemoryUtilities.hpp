@@ -4,7 +4,34 @@
 #include <forge-base/Core/Types.hpp>
 #include <forge-base/Core/System.hpp>
 
+#include "MemoryKernels.hpp"
+
 namespace Forge {
+	// The widest vector the compiler may emit without checking CPUID, the fixed size memory functions are unrolled by it.
+#if defined(__AVX512F__)
+	constexpr Size MEMORY_VECTOR_SIZE = 64;
+#elif defined(__AVX__)
+	constexpr Size MEMORY_VECTOR_SIZE = 32;
+#else
+	constexpr Size MEMORY_VECTOR_SIZE = 16;
+#endif
+
+	// Blocks up to this size are handled inline by the memory functions, larger ones by the memory kernels or the C library.
+	constexpr Size MAX_INLINE_MEMORY_SIZE = 64;
+
+	// Blocks up to this size are compared inline without branching on the data, larger ones by the memory kernels or the C library.
+	constexpr Size MAX_INLINE_COMPARE_SIZE = 32;
+
+	// The fixed size copy and set stop unrolling above this size and call the memory kernels instead.
+	constexpr Size MAX_FIXED_MEMORY_SIZE = 512;
+
+	/**
+	 * @brief Throws std::invalid_argument for a null address passed to one of the memory functions.
+	 *
+	 * Kept out of the memory functions, so their null check stays a single branch that is never taken.
+	 */
+	[[noreturn]] Void ThrowNullAddress();
+
 	/**
 	 * @brief Sets the destination memory block to zero.
 	 *
@@ -16,6 +43,8 @@ namespace Forge {
 	/**
 	 * @brief Sets the destination memory block to the value specified.
 	 *
+	 * Blocks up to MAX_INLINE_MEMORY_SIZE bytes are set inline, larger ones by the memory kernel selected for the running processor.
+	 *
 	 * @param[out] destination The memory block where data will be set.
 	 * @param[in]  value The value to set each byte of the memory block to.
 	 * @param[in]  size  The number of bytes of the memory block to be set to the specified value.
@@ -34,15 +63,45 @@ namespace Forge {
 	/**
 	 * @brief Copies the data from the source memory block to the destination memory block.
 	 *
+	 * Blocks up to MAX_INLINE_MEMORY_SIZE bytes are copied inline, larger ones by the memory kernel selected for the running processor.
+	 *
 	 * @param[out] destination The memory block where data will be copied to.
 	 * @param[in]  source The memory block where data will be copied from.
 	 * @param[in]  size The number of bytes of the memory block to be set to the specified value.
 	 */
 	Void MemoryCopy(VoidPtr destination, ConstVoidPtr source, Size size);
 
+	/**
+	 * @brief Copies a fixed number of bytes from the source memory block to the destination memory block.
+	 *
+	 * Compiles to straight-line vector moves up to MAX_FIXED_MEMORY_SIZE bytes. The addresses are not checked.
+	 *
+	 * @tparam InSize The number of bytes to copy.
+	 *
+	 * @param[out] destination The memory block where data will be copied to. Must not be nullptr.
+	 * @param[in]  source The memory block where data will be copied from. Must not be nullptr.
+	 */
+	template<Size InSize>
+	Void MemoryCopy(VoidPtr destination, ConstVoidPtr source);
+
+	/**
+	 * @brief Sets a fixed number of bytes of the destination memory block to the value specified.
+	 *
+	 * Compiles to straight-line vector stores up to MAX_FIXED_MEMORY_SIZE bytes. The address is not checked.
+	 *
+	 * @tparam InSize The number of bytes to set.
+	 *
+	 * @param[out] destination The memory block where data will be set. Must not be nullptr.
+	 * @param[in]  value The value to set each byte of the memory block to.
+	 */
+	template<Size InSize>
+	Void MemorySet(VoidPtr destination, Byte value);
+
 	/**
 	 * @brief Compares the data stored in the comparand1 memory block and the comparand2 memory block for equality.
 	 *
+	 * Blocks up to MAX_INLINE_COMPARE_SIZE bytes are compared inline without branching on the data, larger ones by the memory kernel selected for the running processor.
+	 *
 	 * @param[in] comparand1 The memory block where data will be comapred.
 	 * @param[in] comparand2 The memory block where data will be comapred.
 	 * @param[in] size The number of bytes of the memory block to compare.
@@ -51,6 +110,21 @@ namespace Forge {
 	 */
 	Bool MemoryCompare(ConstVoidPtr self, ConstVoidPtr other, Size size);
 
+	/**
+	 * @brief Compares a fixed number of bytes of two memory blocks for equality.
+	 *
+	 * Compiles to straight-line loads combined without branches up to MAX_INLINE_COMPARE_SIZE bytes. The addresses are not checked.
+	 *
+	 * @tparam InSize The number of bytes to compare.
+	 *
+	 * @param[in] self The first memory block to compare. Must not be nullptr.
+	 * @param[in] other The second memory block to compare. Must not be nullptr.
+	 *
+	 * @returns True if the data stored in the memory buffers are equal, otherwise false.
+	 */
+	template<Size InSize>
+	Bool MemoryCompare(ConstVoidPtr self, ConstVoidPtr other);
+
 	/**
 	 * @brief Calculates the number of bytes between the start and final address.
 	 *
@@ -61,6 +135,16 @@ namespace Forge {
 	 */
 	Size MemoryDistance(VoidPtr start, VoidPtr final);
 
+	/**
+	 * @brief Aligns the specified address forward to the next multiple of the specified alignment.
+	 *
+	 * @param[in] address The address to align.
+	 * @param[in] alignment The alignment to align the address to. Must be a power of two.
+	 *
+	 * @returns VoidPtr storing the aligned address.
+	 */
+	VoidPtr MemoryAlignForward(VoidPtr address, Size alignment);
+
 
 	/** @brief Moves an object of type InType to another specified object.
 	 *
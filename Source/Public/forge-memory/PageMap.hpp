@@ -0,0 +1,90 @@
+#ifndef PAGE_MAP_HPP
+#define PAGE_MAP_HPP
+
+#include <atomic>
+
+#include <forge-base/Core/Types.hpp>
+#include <forge-base/Core/System.hpp>
+
+namespace Forge {
+	/**
+	 * @brief This class maps pages of the address space to a value, using a three
+	 * level radix tree.
+	 *
+	 * Lookups are three dependent loads and never lock. Nodes are allocated lazily
+	 * the first time a page under them is set, so only the parts of the address
+	 * space actually in use cost memory. Unset pages map to zero.
+	 *
+	 * Set must be externally synchronized. Get may run concurrently with Set as long
+	 * as the looked up page was set before the caller learned of it.
+	 *
+	 * @tparam PageShift The log2 of the page size in bytes.
+	 * @tparam AddressBits The number of significant bits of an address.
+	 */
+	template<Size PageShift, Size AddressBits = 48>
+	class PageMap
+	{
+	public:
+		static constexpr Size PAGE_SIZE = static_cast<Size>(1) << PageShift;
+
+		static constexpr Size KEY_BITS = AddressBits - PageShift;
+		static constexpr Size LEAF_BITS = KEY_BITS / 3;
+		static constexpr Size MIDDLE_BITS = KEY_BITS / 3;
+		static constexpr Size ROOT_BITS = KEY_BITS - LEAF_BITS - MIDDLE_BITS;
+
+		static constexpr Size LEAF_LENGTH = static_cast<Size>(1) << LEAF_BITS;
+		static constexpr Size MIDDLE_LENGTH = static_cast<Size>(1) << MIDDLE_BITS;
+		static constexpr Size ROOT_LENGTH = static_cast<Size>(1) << ROOT_BITS;
+
+	private:
+		struct Leaf
+		{
+			Size m_values[LEAF_LENGTH];
+		};
+
+		struct Middle
+		{
+			::std::atomic<Leaf*> m_leaves[MIDDLE_LENGTH];
+		};
+
+	private:
+		::std::atomic<Middle*> m_root[ROOT_LENGTH];
+
+	public:
+		PageMap();
+		~PageMap();
+
+		PageMap(const PageMap&) = delete;
+		PageMap& operator=(const PageMap&) = delete;
+
+	public:
+		/**
+		 * @brief Gets the value the page containing the specified address maps to.
+		 *
+		 * @param[in] address The address to look up.
+		 *
+		 * @return Size storing the value of the page, or zero if the page was never set.
+		 */
+		Size Get(ConstVoidPtr address) const;
+
+		/**
+		 * @brief Maps every page overlapping the specified address range to the specified value.
+		 *
+		 * @param[in] address The start of the address range.
+		 * @param[in] size    The size of the address range in bytes.
+		 * @param[in] value   The value to map the pages to.
+		 *
+		 * @return True if the pages were mapped, or false if a node could not be allocated.
+		 */
+		Bool Set(ConstVoidPtr address, Size size, Size value);
+
+		/**
+		 * @brief Releases every node, unmapping every page.
+		 */
+		Void Clear();
+	};
+}
+
+#include "../Private/PageMap.inl"
+
+#endif
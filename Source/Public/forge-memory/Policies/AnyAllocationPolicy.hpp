@@ -0,0 +1,231 @@
+#ifndef ANY_ALLOCATION_POLICY_HPP
+#define ANY_ALLOCATION_POLICY_HPP
+
+#include <memory>
+
+#include "IAllocationPolicy.hpp"
+
+namespace Forge {
+	/**
+	 * @brief This policy holds any other memory policy chosen at runtime and
+	 * forwards every call to it through a virtual call.
+	 *
+	 * Only use it where the memory policy is not known at compile time, every
+	 * other memory policy is dispatched statically. Without a memory policy every
+	 * allocation fails.
+	 */
+	class AnyAllocationPolicy final : public IAllocationPolicy<AnyAllocationPolicy>
+	{
+	private:
+		struct Concept
+		{
+			virtual ~Concept() = default;
+
+			virtual Void Initialize(Size capacity) = 0;
+			virtual Void Deinitialize() = 0;
+
+			virtual VoidPtr Allocate(Size size, Size alignment) = 0;
+			virtual VoidPtr Callocate(Size size, Byte value, Size alignment) = 0;
+			virtual VoidPtr Reallocate(VoidPtr address, Size size, Size alignment) = 0;
+			virtual Size    AllocateBatch(Size size, Size alignment, Size count, VoidPtr* addresses) = 0;
+			virtual AllocationResult AllocateAtLeast(Size size, Size alignment) = 0;
+
+			virtual Void Deallocate(VoidPtr address) = 0;
+			virtual Void DeallocateBatch(VoidPtr* addresses, Size count) = 0;
+			virtual Void DeallocateSized(VoidPtr address, Size size, Size alignment) = 0;
+			virtual Size GetAllocatedSize(VoidPtr address) = 0;
+			virtual Size GetRoundedSize(VoidPtr address, Size size, Size alignment) = 0;
+
+			virtual Void Reset() = 0;
+
+			virtual Bool IsHugePageBacked() const = 0;
+		};
+
+		template<typename InPolicy>
+		struct Model final : Concept
+		{
+			InPolicy m_policy;
+
+			template<typename... InArgs>
+			Model(InArgs&&... arguments);
+
+			Void Initialize(Size capacity) override;
+			Void Deinitialize() override;
+
+			VoidPtr Allocate(Size size, Size alignment) override;
+			VoidPtr Callocate(Size size, Byte value, Size alignment) override;
+			VoidPtr Reallocate(VoidPtr address, Size size, Size alignment) override;
+			Size    AllocateBatch(Size size, Size alignment, Size count, VoidPtr* addresses) override;
+			AllocationResult AllocateAtLeast(Size size, Size alignment) override;
+
+			Void Deallocate(VoidPtr address) override;
+			Void DeallocateBatch(VoidPtr* addresses, Size count) override;
+			Void DeallocateSized(VoidPtr address, Size size, Size alignment) override;
+			Size GetAllocatedSize(VoidPtr address) override;
+			Size GetRoundedSize(VoidPtr address, Size size, Size alignment) override;
+
+			Void Reset() override;
+
+			Bool IsHugePageBacked() const override;
+		};
+
+	private:
+		::std::unique_ptr<Concept> m_policy;
+
+	public:
+		/**
+		 * @brief Constructs the memory policy to forward every call to, replacing the current one.
+		 *
+		 * Must be called before Initialize, a replaced memory policy is destroyed without being deinitialized.
+		 *
+		 * @tparam InPolicy The type of memory policy to construct.
+		 * @tparam InArgs The type of constructor arguments.
+		 *
+		 * @param[in] arguments The constructor arguments to forward to the constructor of InPolicy.
+		 *
+		 * @return InPolicy& storing the constructed memory policy.
+		 */
+		template<typename InPolicy, typename... InArgs>
+		InPolicy& Emplace(InArgs&&... arguments);
+
+		/**
+		 * @brief Checks whether a memory policy has been constructed.
+		 *
+		 * @return True if calls are forwarded to a memory policy, otherwise false.
+		 */
+		Bool HasPolicy() const;
+
+	public:
+		/**
+		 * @brief Initializes a memory pool with the specified capacity using the held memory policy.
+		 *
+		 * @param capacity The size of the memory pool to initialize in bytes.
+		 */
+		Void Initialize(Size capacity);
+
+		/**
+		 * @brief Deinitializes the memory pool managed by the held memory policy.
+		 */
+		Void Deinitialize();
+
+	public:
+		/**
+		 * @brief Allocates a block of memory with the specified size and alignment using the held memory policy.
+		 *
+		 * @param[in] size      The size of the memory block to allocate in bytes.
+		 * @param[in] alignment The alignment requirement for the memory block. Must be a power of two.
+		 *
+		 * @return VoidPtr storing the address the allocated memory block, or nullptr if there is no memory policy.
+		 */
+		VoidPtr Allocate(Size size, Size alignment);
+
+		/**
+		 * @brief Allocates a block of memory with the specified size and alignment using the held memory policy.
+		 *
+		 * @param[in] size      The size of the memory block to allocate in bytes.
+		 * @param[in] value     The value to set each byte of the memory block to.
+		 * @param[in] alignment The alignment requirement for the memory block. Must be a power of two.
+		 *
+		 * @return VoidPtr storing the address the allocated memory block, or nullptr if there is no memory policy.
+		 */
+		VoidPtr Callocate(Size size, Byte value, Size alignment);
+
+		/**
+		 * @brief Reallocates a block of memory with the specified size and alignment using the held memory policy.
+		 *
+		 * @param[in] address   The address of the memory block to reallocate.
+		 * @param[in] size      The size of the memory block to reallocate in bytes.
+		 * @param[in] alignment The alignment requirement for the memory block. Must be a power of two.
+		 *
+		 * @returns VoidPtr storing the address the reallocated memory block, or nullptr if there is no memory policy.
+		 */
+		VoidPtr Reallocate(VoidPtr address, Size size, Size alignment);
+
+		/**
+		 * @brief Allocates a number of memory blocks with the same size and alignment using the held memory policy.
+		 *
+		 * Costs a single virtual call for the whole batch.
+		 *
+		 * @param[in]  size      The size of each memory block to allocate in bytes.
+		 * @param[in]  alignment The alignment requirement for each memory block. Must be a power of two.
+		 * @param[in]  count     The number of memory blocks to allocate.
+		 * @param[out] addresses The array receiving the address of each allocated memory block. Must hold count entries.
+		 *
+		 * @return Size storing the number of memory blocks allocated, or zero if there is no memory policy.
+		 */
+		Size AllocateBatch(Size size, Size alignment, Size count, VoidPtr* addresses);
+
+		/**
+		 * @brief Allocates a block of memory of at least the specified size using the held memory policy.
+		 *
+		 * @param[in] size      The minimum size of the memory block to allocate in bytes.
+		 * @param[in] alignment The alignment requirement for the memory block. Must be a power of two.
+		 *
+		 * @return AllocationResult storing the address of the allocated memory block and its usable size, or nullptr and zero if there is no memory policy.
+		 */
+		AllocationResult AllocateAtLeast(Size size, Size alignment);
+
+	public:
+		/**
+		 * @brief Deallocates a block of memory with the specified address using the held memory policy.
+		 *
+		 * @param[in] address The address of the memory block to deallocate.
+		 */
+		Void Deallocate(VoidPtr address);
+
+		/**
+		 * @brief Deallocates a number of memory blocks using the held memory policy.
+		 *
+		 * @param[in] addresses The array storing the address of each memory block to deallocate.
+		 * @param[in] count     The number of memory blocks to deallocate.
+		 */
+		Void DeallocateBatch(VoidPtr* addresses, Size count);
+
+		/**
+		 * @brief Deallocates a block of memory whose size and alignment are known to the caller using the held memory policy.
+		 *
+		 * @param[in] address   The address of the memory block to deallocate.
+		 * @param[in] size      The size the memory block was last allocated or reallocated with.
+		 * @param[in] alignment The alignment the memory block was last allocated or reallocated with.
+		 */
+		Void DeallocateSized(VoidPtr address, Size size, Size alignment);
+
+		/**
+		 * @brief Gets the usable size of the memory block at the specified address.
+		 *
+		 * @param[in] address The address of the memory block.
+		 *
+		 * @return Size storing the usable size reported by the held memory policy in bytes.
+		 */
+		Size GetAllocatedSize(VoidPtr address);
+
+		/**
+		 * @brief Gets the usable size of a memory block from the size and alignment it was allocated with.
+		 *
+		 * @param[in] address   The address of the memory block.
+		 * @param[in] size      The size the memory block was last allocated or reallocated with.
+		 * @param[in] alignment The alignment the memory block was last allocated or reallocated with.
+		 *
+		 * @return Size storing the usable size reported by the held memory policy in bytes.
+		 */
+		Size GetRoundedSize(VoidPtr address, Size size, Size alignment);
+
+	public:
+		/**
+		 * @brief Resets the entire memory pool of the held memory policy.
+		 */
+		Void Reset();
+
+	public:
+		/**
+		 * @brief Checks whether the memory pool of the held memory policy is backed by huge pages.
+		 *
+		 * @returns True if the memory pool is backed by huge pages, otherwise false.
+		 */
+		Bool IsHugePageBacked() const;
+	};
+}
+
+#include "../Private/Policies/AnyAllocationPolicy.inl"
+
+#endif
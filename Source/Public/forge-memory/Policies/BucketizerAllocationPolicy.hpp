@@ -0,0 +1,188 @@
+#ifndef BUCKETIZER_ALLOCATION_POLICY_HPP
+#define BUCKETIZER_ALLOCATION_POLICY_HPP
+
+#include "IAllocationPolicy.hpp"
+
+namespace Forge {
+	/**
+	 * @brief This policy splits a range of request sizes into equally wide buckets,
+	 * each served by its own instance of a memory policy.
+	 *
+	 * Requests outside of the range fail, combine it with FallbackAllocationPolicy or
+	 * SegregatorAllocationPolicy to serve them elsewhere. The capacity is split evenly
+	 * between the buckets, use GetBucket to initialize them separately. Deallocations
+	 * are routed by asking each bucket whether it owns the memory block.
+	 *
+	 * @tparam InPolicy The memory policy of each bucket. Must be able to tell its own memory blocks apart.
+	 * @tparam MinSize The smallest request served in bytes.
+	 * @tparam MaxSize The largest request served in bytes.
+	 * @tparam StepSize The range of request sizes served by each bucket in bytes.
+	 */
+	template<typename InPolicy, Size MinSize, Size MaxSize, Size StepSize>
+	class BucketizerAllocationPolicy final : public IAllocationPolicy<BucketizerAllocationPolicy<InPolicy, MinSize, MaxSize, StepSize>>
+	{
+		static_assert(IsOwningAllocationPolicy<InPolicy>::value, "InPolicy must provide Owns to route deallocations");
+		static_assert(StepSize > 0, "StepSize must not be zero");
+		static_assert(MinSize <= MaxSize, "MinSize must not be larger than MaxSize");
+
+	public:
+		static constexpr Size NUM_OF_BUCKETS = (MaxSize - MinSize) / StepSize + 1;
+
+	private:
+		InPolicy m_buckets[NUM_OF_BUCKETS];
+
+	public:
+		/**
+		 * @brief Gets the memory policy of the bucket at the specified index.
+		 *
+		 * @param[in] index The index of the bucket. Must be smaller than NUM_OF_BUCKETS.
+		 *
+		 * @return InPolicy& storing the memory policy of the bucket.
+		 */
+		InPolicy& GetBucket(Size index);
+
+	public:
+		/**
+		 * @brief Initializes the memory policy of each bucket with an even share of the specified capacity.
+		 *
+		 * @param capacity The size of the memory pool shared by all buckets in bytes.
+		 */
+		Void Initialize(Size capacity);
+
+		/**
+		 * @brief Deinitializes the memory policy of each bucket.
+		 */
+		Void Deinitialize();
+
+	public:
+		/**
+		 * @brief Allocates a block of memory from the bucket serving the specified size.
+		 *
+		 * @param[in] size      The size of the memory block to allocate in bytes.
+		 * @param[in] alignment The alignment requirement for the memory block. Must be a power of two.
+		 *
+		 * @return VoidPtr storing the address the allocated memory block, or nullptr if the size is out of range.
+		 */
+		VoidPtr Allocate(Size size, Size alignment);
+
+		/**
+		 * @brief Allocates a block of memory from the bucket serving the specified size.
+		 *
+		 * @param[in] size      The size of the memory block to allocate in bytes.
+		 * @param[in] value     The value to set each byte of the memory block to.
+		 * @param[in] alignment The alignment requirement for the memory block. Must be a power of two.
+		 *
+		 * @return VoidPtr storing the address the allocated memory block, or nullptr if the size is out of range.
+		 */
+		VoidPtr Callocate(Size size, Byte value, Size alignment);
+
+		/**
+		 * @brief Allocates a block of memory of at least the specified size from the bucket serving that size.
+		 *
+		 * The usable size reported never exceeds the size range of the bucket, so a sized deallocation
+		 * with it is routed back to the same bucket.
+		 *
+		 * @param[in] size      The minimum size of the memory block to allocate in bytes.
+		 * @param[in] alignment The alignment requirement for the memory block. Must be a power of two.
+		 *
+		 * @return AllocationResult storing the address of the allocated memory block and its usable size.
+		 */
+		AllocationResult AllocateAtLeast(Size size, Size alignment);
+
+		/**
+		 * @brief Reallocates a block of memory, moving it to another bucket if the new size is served by it.
+		 *
+		 * @param[in] address   The address of the memory block to reallocate.
+		 * @param[in] size      The size of the memory block to reallocate in bytes.
+		 * @param[in] alignment The alignment requirement for the memory block. Must be a power of two.
+		 *
+		 * @returns VoidPtr storing the address the reallocated memory block, or nullptr if the size is out of range.
+		 */
+		VoidPtr Reallocate(VoidPtr address, Size size, Size alignment);
+
+		/**
+		 * @brief Allocates a number of memory blocks from the bucket serving the specified size.
+		 *
+		 * @param[in]  size      The size of each memory block to allocate in bytes.
+		 * @param[in]  alignment The alignment requirement for each memory block. Must be a power of two.
+		 * @param[in]  count     The number of memory blocks to allocate.
+		 * @param[out] addresses The array receiving the address of each allocated memory block. Must hold count entries.
+		 *
+		 * @return Size storing the number of memory blocks allocated, zero if the size is out of range.
+		 */
+		Size AllocateBatch(Size size, Size alignment, Size count, VoidPtr* addresses);
+
+	public:
+		/**
+		 * @brief Deallocates a block of memory using the bucket that owns it.
+		 *
+		 * @param[in] address The address of the memory block to deallocate.
+		 */
+		Void Deallocate(VoidPtr address);
+
+		/**
+		 * @brief Deallocates a block of memory whose size and alignment are known to the caller.
+		 *
+		 * The bucket is picked from the size, so no bucket is asked for ownership.
+		 *
+		 * @param[in] address   The address of the memory block to deallocate.
+		 * @param[in] size      The size the memory block was last allocated or reallocated with.
+		 * @param[in] alignment The alignment the memory block was last allocated or reallocated with.
+		 */
+		Void DeallocateSized(VoidPtr address, Size size, Size alignment);
+
+		/**
+		 * @brief Gets the usable size of the memory block at the specified address.
+		 *
+		 * @param[in] address The address of the memory block.
+		 *
+		 * @return Size storing the usable size reported by the bucket that owns the memory block in bytes.
+		 */
+		Size GetAllocatedSize(VoidPtr address);
+
+		/**
+		 * @brief Gets the usable size of a memory block from the size and alignment it was allocated with.
+		 *
+		 * The bucket is picked from the size, so no bucket is asked for ownership.
+		 *
+		 * @param[in] address   The address of the memory block.
+		 * @param[in] size      The size the memory block was last allocated or reallocated with.
+		 * @param[in] alignment The alignment the memory block was last allocated or reallocated with.
+		 *
+		 * @return Size storing the usable size reported by the bucket that owns the memory block in bytes.
+		 */
+		Size GetRoundedSize(VoidPtr address, Size size, Size alignment);
+
+		/**
+		 * @brief Checks whether the memory block at the specified address was allocated from any bucket.
+		 *
+		 * @param[in] address The address of the memory block.
+		 *
+		 * @return True if any bucket owns the memory block, otherwise false.
+		 */
+		Bool Owns(VoidPtr address);
+
+	public:
+		/**
+		 * @brief Resets the memory pool of each bucket.
+		 */
+		Void Reset();
+
+	public:
+		/**
+		 * @brief Checks whether the memory pools of all buckets are backed by huge pages.
+		 *
+		 * @returns True if all memory pools are backed by huge pages, otherwise false.
+		 */
+		Bool IsHugePageBacked() const;
+
+	private:
+		static Bool IsInRange(Size size);
+		static Size GetBucketIndex(Size size);
+		Size FindOwner(VoidPtr address);
+	};
+}
+
+#include "../Private/Policies/BucketizerAllocationPolicy.inl"
+
+#endif
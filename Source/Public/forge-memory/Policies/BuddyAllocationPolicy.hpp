@@ -0,0 +1,174 @@
+#ifndef BUDDY_ALLOCATION_POLICY_HPP
+#define BUDDY_ALLOCATION_POLICY_HPP
+
+#include "IAllocationPolicy.hpp"
+
+namespace Forge {
+	/**
+	 * @brief This policy implements a binary buddy allocator over a fixed memory pool.
+	 *
+	 * The memory pool is rounded down to a power of two and every request is served
+	 * by a power of two block. Blocks are split on allocation and merged with their
+	 * buddy on deallocation in O(log n), using a per-order free list and a bitmap
+	 * storing whether exactly one block of each buddy pair is free.
+	 */
+	class BuddyAllocationPolicy final : public IAllocationPolicy<BuddyAllocationPolicy>
+	{
+	private:
+		struct FreeBlock
+		{
+			FreeBlock* m_next;
+			FreeBlock* m_previous;
+		};
+
+	public:
+		static constexpr Size MIN_BLOCK_SIZE_LOG2 = 6;
+		static constexpr Size MIN_BLOCK_SIZE = static_cast<Size>(1) << MIN_BLOCK_SIZE_LOG2;
+		static constexpr Size MAX_NUM_OF_ORDERS = 48;
+		static constexpr Size POOL_ALIGNMENT = 4096;
+
+	private:
+		VoidPtr m_memory;
+		Byte*   m_start;
+		Size    m_max_order;
+
+	private:
+		FreeBlock* m_free_lists[MAX_NUM_OF_ORDERS];
+		Size       m_free_orders;
+
+	private:
+		Byte* m_buddy_bitmap;
+		Size  m_bitmap_offsets[MAX_NUM_OF_ORDERS];
+		Byte* m_block_orders;
+
+	public:
+		BuddyAllocationPolicy();
+
+	public:
+		/**
+		 * @brief Gets the size of the largest free block in the memory pool.
+		 *
+		 * @return Size storing the size of the largest block that can currently be allocated in bytes.
+		 */
+		Size GetLargestFreeBlock();
+
+		/**
+		 * @brief Gets the size of the power of two block at the specified address.
+		 *
+		 * @param[in] address The address of the memory block.
+		 *
+		 * @return Size storing the size of the memory block in bytes.
+		 */
+		Size GetAllocatedSize(VoidPtr address);
+
+		/**
+		 * @brief Gets the size of the power of two block a memory block of the specified size and alignment was placed in.
+		 *
+		 * The order follows from the size and alignment, so the block order table is not read.
+		 *
+		 * @param[in] address   The address of the memory block.
+		 * @param[in] size      The size the memory block was last allocated or reallocated with.
+		 * @param[in] alignment The alignment the memory block was last allocated or reallocated with.
+		 *
+		 * @return Size storing the size of the memory block in bytes.
+		 */
+		Size GetRoundedSize(VoidPtr address, Size size, Size alignment);
+
+		/**
+		 * @brief Checks whether the memory block at the specified address was allocated from the memory pool.
+		 *
+		 * @param[in] address The address of the memory block.
+		 *
+		 * @return True if the address lies within the memory pool, otherwise false.
+		 */
+		Bool Owns(VoidPtr address);
+
+	public:
+		/**
+		 * @brief Initializes a memory pool with the specified capacity using a defined memory policy.
+		 *
+		 * @param capacity The size of the memory pool to initialize in bytes, rounded down to a power of two.
+		 */
+		Void Initialize(Size capacity);
+
+		/**
+		 * @brief Deinitializes the memory pool managed by the defined memory policy.
+		 */
+		Void Deinitialize();
+
+	public:
+		/**
+		 * @brief Allocates a block of memory with the specified size and alignment from the memory pool.
+		 *
+		 * @param[in] size      The size of the memory block to allocate in bytes.
+		 * @param[in] alignment The alignment requirement for the memory block. Must be a power of two not exceeding POOL_ALIGNMENT.
+		 *
+		 * @return VoidPtr storing the address the allocated memory block, or nullptr if the memory pool is exhausted.
+		 */
+		VoidPtr Allocate(Size size, Size alignment);
+
+		/**
+		 * @brief Allocates a block of memory with the specified size and alignment from the memory pool.
+		 *
+		 * @param[in] size      The size of the memory block to allocate in bytes.
+		 * @param[in] value     The value to set each byte of the memory block to.
+		 * @param[in] alignment The alignment requirement for the memory block. Must be a power of two not exceeding POOL_ALIGNMENT.
+		 *
+		 * @return VoidPtr storing the address the allocated memory block, or nullptr if the memory pool is exhausted.
+		 */
+		VoidPtr Callocate(Size size, Byte value, Size alignment);
+
+		/**
+		 * @brief Reallocates a block of memory with the specified size and alignment from the memory pool.
+		 *
+		 * Shrinking releases the unused upper halves in place, growing merges free buddies in place when possible.
+		 *
+		 * @param[in] address   The address of the memory block to reallocate.
+		 * @param[in] size      The size of the memory block to reallocate in bytes.
+		 * @param[in] alignment The alignment requirement for the memory block. Must be a power of two not exceeding POOL_ALIGNMENT.
+		 *
+		 * @returns VoidPtr storing the address the reallocated memory block, or nullptr if the memory pool is exhausted.
+		 */
+		VoidPtr Reallocate(VoidPtr address, Size size, Size alignment);
+
+	public:
+		/**
+		 * @brief Deallocates a block of memory and merges it with its free buddies.
+		 *
+		 * @param[in] address The address of the memory block to deallocate.
+		 */
+		Void Deallocate(VoidPtr address);
+
+		/**
+		 * @brief Deallocates a block of memory whose size and alignment are known to the caller and merges it with its free buddies.
+		 *
+		 * The order of the memory block follows from the size and alignment, so the block order table is not read.
+		 *
+		 * @param[in] address   The address of the memory block to deallocate.
+		 * @param[in] size      The size the memory block was last allocated or reallocated with.
+		 * @param[in] alignment The alignment the memory block was last allocated or reallocated with.
+		 */
+		Void DeallocateSized(VoidPtr address, Size size, Size alignment);
+
+	public:
+		/**
+		 * @brief Resets the entire memory pool back to a single free block.
+		 */
+		Void Reset();
+
+	private:
+		Size GetOrder(Size size, Size alignment);
+
+		Bool ToggleBuddyBit(Size offset, Size order);
+
+		Void PushFreeBlock(Size offset, Size order);
+		Void RemoveFreeBlock(Size offset, Size order);
+		Size PopFreeBlock(Size order);
+
+		Void ReleaseBlock(Size offset, Size order);
+	};
+}
+
+#include "../Private/Policies/BuddyAllocationPolicy.inl"
+
+#endif
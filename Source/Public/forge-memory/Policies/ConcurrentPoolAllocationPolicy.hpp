@@ -0,0 +1,170 @@
+#ifndef CONCURRENT_POOL_ALLOCATION_POLICY_HPP
+#define CONCURRENT_POOL_ALLOCATION_POLICY_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+
+#include "IAllocationPolicy.hpp"
+
+namespace Forge {
+	/**
+	 * @brief This policy carves a fixed memory pool into equally sized blocks that can
+	 * be allocated and deallocated from many threads at once.
+	 *
+	 * Free blocks are kept in a lock-free stack. The head stores a block index and a
+	 * tag that is bumped by every successful update, which protects the stack from
+	 * the ABA problem without requiring a double-width compare and swap.
+	 *
+	 * Initialize, Deinitialize and Reset must not run concurrently with other calls.
+	 *
+	 * @tparam BlockSize The size of each memory block in bytes.
+	 * @tparam BlockAlignment The alignment of each memory block. Must be a power of two.
+	 */
+	template<Size BlockSize, Size BlockAlignment = alignof(::std::max_align_t)>
+	class ConcurrentPoolAllocationPolicy final : public IAllocationPolicy<ConcurrentPoolAllocationPolicy<BlockSize, BlockAlignment>>
+	{
+		static_assert(BlockSize > 0, "The block size must be greater than zero");
+		static_assert((BlockAlignment & (BlockAlignment - 1)) == 0, "The block alignment must be a power of two");
+
+	private:
+		using FreeBlock = ::std::atomic<::std::uint32_t>;
+
+	public:
+		static constexpr Size CACHE_LINE_SIZE = 64;
+		static constexpr Size BLOCK_ALIGNMENT = BlockAlignment < alignof(FreeBlock) ? alignof(FreeBlock) : BlockAlignment;
+		static constexpr Size BLOCK_STRIDE = ((BlockSize < sizeof(FreeBlock) ? sizeof(FreeBlock) : BlockSize) + (BLOCK_ALIGNMENT - 1)) & ~(BLOCK_ALIGNMENT - 1);
+		static constexpr Size MAX_NUM_OF_BLOCKS = 0xFFFFFFFE;
+
+	private:
+		VoidPtr m_memory;
+		Byte*   m_start;
+		Size    m_num_of_blocks;
+
+	private:
+		// Packs the tag in the upper 32 bits and the block index plus one in the lower 32 bits, zero means empty.
+		alignas(CACHE_LINE_SIZE) ::std::atomic<::std::uint64_t> m_head;
+		alignas(CACHE_LINE_SIZE) ::std::atomic<Size> m_num_of_touched_blocks;
+
+	public:
+		ConcurrentPoolAllocationPolicy();
+
+	public:
+		/**
+		 * @brief Gets the number of memory blocks in the memory pool.
+		 *
+		 * @return Size storing the number of memory blocks in the memory pool.
+		 */
+		Size GetNumOfBlocks();
+
+	public:
+		/**
+		 * @brief Initializes a memory pool with the specified capacity using a defined memory policy.
+		 *
+		 * @param capacity The size of the memory pool to initialize in bytes.
+		 */
+		Void Initialize(Size capacity);
+
+		/**
+		 * @brief Deinitializes the memory pool managed by the defined memory policy.
+		 */
+		Void Deinitialize();
+
+	public:
+		/**
+		 * @brief Allocates a memory block from the memory pool, safe to call from any thread.
+		 *
+		 * @param[in] size      The size of the memory block to allocate in bytes. Must not exceed BlockSize.
+		 * @param[in] alignment The alignment requirement for the memory block. Must not exceed BlockAlignment.
+		 *
+		 * @return VoidPtr storing the address the allocated memory block, or nullptr if the memory pool is exhausted.
+		 */
+		VoidPtr Allocate(Size size, Size alignment);
+
+		/**
+		 * @brief Allocates a memory block from the memory pool, safe to call from any thread.
+		 *
+		 * @param[in] size      The size of the memory block to allocate in bytes. Must not exceed BlockSize.
+		 * @param[in] value     The value to set each byte of the memory block to.
+		 * @param[in] alignment The alignment requirement for the memory block. Must not exceed BlockAlignment.
+		 *
+		 * @return VoidPtr storing the address the allocated memory block, or nullptr if the memory pool is exhausted.
+		 */
+		VoidPtr Callocate(Size size, Byte value, Size alignment);
+
+		/**
+		 * @brief Reallocates a memory block from the memory pool.
+		 *
+		 * Since every memory block has the same size, the block is returned as is if the size still fits.
+		 *
+		 * @param[in] address   The address of the memory block to reallocate.
+		 * @param[in] size      The size of the memory block to reallocate in bytes.
+		 * @param[in] alignment The alignment requirement for the memory block. Must be a power of two.
+		 *
+		 * @returns VoidPtr storing the address the reallocated memory block, or nullptr if the size does not fit a block.
+		 */
+		VoidPtr Reallocate(VoidPtr address, Size size, Size alignment);
+
+		/**
+		 * @brief Allocates a number of memory blocks from the memory pool, popping the free list first and claiming the
+		 * untouched blocks with a single atomic bump.
+		 *
+		 * @param[in]  size      The size of each memory block to allocate in bytes. Must not exceed BlockSize.
+		 * @param[in]  alignment The alignment requirement for each memory block. Must not exceed BlockAlignment.
+		 * @param[in]  count     The number of memory blocks to allocate.
+		 * @param[out] addresses The array receiving the address of each allocated memory block. Must hold count entries.
+		 *
+		 * @return Size storing the number of memory blocks allocated, fewer than count if the memory pool is exhausted.
+		 */
+		Size AllocateBatch(Size size, Size alignment, Size count, VoidPtr* addresses);
+
+	public:
+		/**
+		 * @brief Deallocates a memory block by pushing it on the free list, safe to call from any thread.
+		 *
+		 * @param[in] address The address of the memory block to deallocate.
+		 */
+		Void Deallocate(VoidPtr address);
+
+		/**
+		 * @brief Deallocates a number of memory blocks by linking them into a chain and pushing it on the free list
+		 * with a single compare and swap.
+		 *
+		 * @param[in] addresses The array storing the address of each memory block to deallocate. Null entries are skipped.
+		 * @param[in] count     The number of memory blocks to deallocate.
+		 */
+		Void DeallocateBatch(VoidPtr* addresses, Size count);
+
+		/**
+		 * @brief Gets the usable size of the memory block at the specified address.
+		 *
+		 * @param[in] address The address of the memory block.
+		 *
+		 * @return Size storing the block size of the memory pool in bytes.
+		 */
+		Size GetAllocatedSize(VoidPtr address);
+
+		/**
+		 * @brief Checks whether the memory block at the specified address was allocated from the memory pool.
+		 *
+		 * @param[in] address The address of the memory block.
+		 *
+		 * @return True if the address lies within the memory pool, otherwise false.
+		 */
+		Bool Owns(VoidPtr address);
+
+	public:
+		/**
+		 * @brief Resets the entire memory pool.
+		 */
+		Void Reset();
+
+	private:
+		Byte*      GetBlock(::std::uint32_t index);
+		FreeBlock* GetFreeBlock(::std::uint32_t index);
+	};
+}
+
+#include "../Private/Policies/ConcurrentPoolAllocationPolicy.inl"
+
+#endif
@@ -0,0 +1,182 @@
+#ifndef FALLBACK_ALLOCATION_POLICY_HPP
+#define FALLBACK_ALLOCATION_POLICY_HPP
+
+#include <type_traits>
+
+#include "IAllocationPolicy.hpp"
+
+namespace Forge {
+	/**
+	 * @brief This policy allocates from a primary memory policy and falls back to
+	 * a secondary memory policy once the primary one is exhausted.
+	 *
+	 * Deallocations are routed by asking the primary memory policy whether it owns
+	 * the memory block. Both memory policies are initialized with the full capacity,
+	 * use GetPrimary and GetSecondary to initialize them separately.
+	 *
+	 * @tparam Primary The memory policy to allocate from first. Must be able to tell its own memory blocks apart.
+	 * @tparam Secondary The memory policy to allocate from once the primary one is exhausted.
+	 */
+	template<typename Primary, typename Secondary>
+	class FallbackAllocationPolicy final : public IAllocationPolicy<FallbackAllocationPolicy<Primary, Secondary>>
+	{
+		static_assert(IsOwningAllocationPolicy<Primary>::value, "Primary must provide Owns to route deallocations");
+		static_assert(IsAllocationPolicy<Secondary>::value, "Secondary does not satisfy the memory policy contract of IAllocationPolicy");
+
+	private:
+		Primary   m_primary;
+		Secondary m_secondary;
+
+	public:
+		/**
+		 * @brief Gets the memory policy allocated from first.
+		 *
+		 * @return Primary& storing the primary memory policy.
+		 */
+		Primary& GetPrimary();
+
+		/**
+		 * @brief Gets the memory policy allocated from once the primary one is exhausted.
+		 *
+		 * @return Secondary& storing the secondary memory policy.
+		 */
+		Secondary& GetSecondary();
+
+	public:
+		/**
+		 * @brief Initializes both memory policies with the specified capacity.
+		 *
+		 * @param capacity The size of the memory pool of each memory policy in bytes.
+		 */
+		Void Initialize(Size capacity);
+
+		/**
+		 * @brief Deinitializes both memory policies.
+		 */
+		Void Deinitialize();
+
+	public:
+		/**
+		 * @brief Allocates a block of memory from the primary memory policy, or from the secondary one if that fails.
+		 *
+		 * @param[in] size      The size of the memory block to allocate in bytes.
+		 * @param[in] alignment The alignment requirement for the memory block. Must be a power of two.
+		 *
+		 * @return VoidPtr storing the address the allocated memory block, or nullptr if both memory policies are exhausted.
+		 */
+		VoidPtr Allocate(Size size, Size alignment);
+
+		/**
+		 * @brief Allocates a block of memory from the primary memory policy, or from the secondary one if that fails.
+		 *
+		 * @param[in] size      The size of the memory block to allocate in bytes.
+		 * @param[in] value     The value to set each byte of the memory block to.
+		 * @param[in] alignment The alignment requirement for the memory block. Must be a power of two.
+		 *
+		 * @return VoidPtr storing the address the allocated memory block, or nullptr if both memory policies are exhausted.
+		 */
+		VoidPtr Callocate(Size size, Byte value, Size alignment);
+
+		/**
+		 * @brief Allocates a block of memory of at least the specified size from the primary memory policy, or from the secondary one if that fails.
+		 *
+		 * @param[in] size      The minimum size of the memory block to allocate in bytes.
+		 * @param[in] alignment The alignment requirement for the memory block. Must be a power of two.
+		 *
+		 * @return AllocationResult storing the address of the allocated memory block and its usable size.
+		 */
+		AllocationResult AllocateAtLeast(Size size, Size alignment);
+
+		/**
+		 * @brief Reallocates a block of memory using the memory policy that owns it.
+		 *
+		 * A memory block the primary memory policy cannot grow is moved to the secondary one.
+		 *
+		 * @param[in] address   The address of the memory block to reallocate.
+		 * @param[in] size      The size of the memory block to reallocate in bytes.
+		 * @param[in] alignment The alignment requirement for the memory block. Must be a power of two.
+		 *
+		 * @returns VoidPtr storing the address the reallocated memory block, or nullptr if both memory policies are exhausted.
+		 */
+		VoidPtr Reallocate(VoidPtr address, Size size, Size alignment);
+
+		/**
+		 * @brief Allocates a number of memory blocks from the primary memory policy, and the rest from the secondary one.
+		 *
+		 * @param[in]  size      The size of each memory block to allocate in bytes.
+		 * @param[in]  alignment The alignment requirement for each memory block. Must be a power of two.
+		 * @param[in]  count     The number of memory blocks to allocate.
+		 * @param[out] addresses The array receiving the address of each allocated memory block. Must hold count entries.
+		 *
+		 * @return Size storing the number of memory blocks allocated, fewer than count if both memory policies are exhausted.
+		 */
+		Size AllocateBatch(Size size, Size alignment, Size count, VoidPtr* addresses);
+
+	public:
+		/**
+		 * @brief Deallocates a block of memory using the memory policy that owns it.
+		 *
+		 * @param[in] address The address of the memory block to deallocate.
+		 */
+		Void Deallocate(VoidPtr address);
+
+		/**
+		 * @brief Deallocates a block of memory whose size and alignment are known to the caller using the memory policy that owns it.
+		 *
+		 * @param[in] address   The address of the memory block to deallocate.
+		 * @param[in] size      The size the memory block was last allocated or reallocated with.
+		 * @param[in] alignment The alignment the memory block was last allocated or reallocated with.
+		 */
+		Void DeallocateSized(VoidPtr address, Size size, Size alignment);
+
+		/**
+		 * @brief Gets the usable size of the memory block at the specified address.
+		 *
+		 * @param[in] address The address of the memory block.
+		 *
+		 * @return Size storing the usable size reported by the memory policy that owns the memory block in bytes.
+		 */
+		Size GetAllocatedSize(VoidPtr address);
+
+		/**
+		 * @brief Gets the usable size of a memory block from the size and alignment it was allocated with.
+		 *
+		 * @param[in] address   The address of the memory block.
+		 * @param[in] size      The size the memory block was last allocated or reallocated with.
+		 * @param[in] alignment The alignment the memory block was last allocated or reallocated with.
+		 *
+		 * @return Size storing the usable size reported by the memory policy that owns the memory block in bytes.
+		 */
+		Size GetRoundedSize(VoidPtr address, Size size, Size alignment);
+
+		/**
+		 * @brief Checks whether the memory block at the specified address was allocated from either memory policy.
+		 *
+		 * Only available if the secondary memory policy can tell its own memory blocks apart as well.
+		 *
+		 * @param[in] address The address of the memory block.
+		 *
+		 * @return True if either memory policy owns the memory block, otherwise false.
+		 */
+		template<typename InSecondary = Secondary, typename = ::std::enable_if_t<IsOwningAllocationPolicy<InSecondary>::value>>
+		Bool Owns(VoidPtr address);
+
+	public:
+		/**
+		 * @brief Resets the memory pools of both memory policies.
+		 */
+		Void Reset();
+
+	public:
+		/**
+		 * @brief Checks whether the memory pools of both memory policies are backed by huge pages.
+		 *
+		 * @returns True if both memory pools are backed by huge pages, otherwise false.
+		 */
+		Bool IsHugePageBacked() const;
+	};
+}
+
+#include "../Private/Policies/FallbackAllocationPolicy.inl"
+
+#endif
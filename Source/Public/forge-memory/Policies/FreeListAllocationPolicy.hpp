@@ -0,0 +1,205 @@
+#ifndef FREE_LIST_ALLOCATION_POLICY_HPP
+#define FREE_LIST_ALLOCATION_POLICY_HPP
+
+#include "IAllocationPolicy.hpp"
+
+namespace Forge {
+	/**
+	 * @brief This policy implements a two-level segregated fit (TLSF) allocator over
+	 * a fixed memory pool.
+	 *
+	 * Free blocks are kept in segregated free lists indexed by a two-level bitmap,
+	 * so finding a suitable block is a pair of bit scans. Boundary tags let freed
+	 * blocks coalesce immediately with their physical neighbours. Allocate,
+	 * Deallocate and Reallocate are O(1) in the worst case, excluding the copy of
+	 * a reallocation that cannot be served in place.
+	 */
+	class FreeListAllocationPolicy final : public IAllocationPolicy<FreeListAllocationPolicy>
+	{
+	private:
+		struct BlockHeader
+		{
+			// Only valid if the previous physical block is free, overlaps the payload of the previous block otherwise.
+			BlockHeader* m_previous_physical;
+
+			// The lowest two bits store whether this block and the previous physical block are free.
+			Size m_size;
+
+			// Only valid if this block is free, overlaps the payload of this block otherwise.
+			BlockHeader* m_next_free;
+			BlockHeader* m_previous_free;
+		};
+
+	public:
+		static constexpr Size ALIGNMENT_LOG2 = 3;
+		static constexpr Size ALIGNMENT = static_cast<Size>(1) << ALIGNMENT_LOG2;
+
+		static constexpr Size SL_INDEX_COUNT_LOG2 = 5;
+		static constexpr Size SL_INDEX_COUNT = static_cast<Size>(1) << SL_INDEX_COUNT_LOG2;
+
+		static constexpr Size FL_INDEX_MAX = 38;
+		static constexpr Size FL_INDEX_SHIFT = SL_INDEX_COUNT_LOG2 + ALIGNMENT_LOG2;
+		static constexpr Size FL_INDEX_COUNT = FL_INDEX_MAX - FL_INDEX_SHIFT + 1;
+
+		static constexpr Size SMALL_BLOCK_SIZE = static_cast<Size>(1) << FL_INDEX_SHIFT;
+
+	private:
+		static constexpr Size BLOCK_FREE_BIT = 1;
+		static constexpr Size BLOCK_PREVIOUS_FREE_BIT = 2;
+
+		static constexpr Size BLOCK_HEADER_OVERHEAD = sizeof(Size);
+		static constexpr Size BLOCK_START_OFFSET = sizeof(BlockHeader*) + sizeof(Size);
+
+		static constexpr Size BLOCK_SIZE_MIN = sizeof(BlockHeader) - sizeof(BlockHeader*);
+		static constexpr Size BLOCK_SIZE_MAX = static_cast<Size>(1) << FL_INDEX_MAX;
+
+	private:
+		VoidPtr m_memory;
+		Size    m_capacity;
+		Bool    m_is_memory_owned;
+
+	private:
+		Size         m_fl_bitmap;
+		Size         m_sl_bitmap[FL_INDEX_COUNT];
+		BlockHeader* m_blocks[FL_INDEX_COUNT][SL_INDEX_COUNT];
+
+	public:
+		FreeListAllocationPolicy();
+
+	public:
+		/**
+		 * @brief Gets the usable size of the memory block at the specified address.
+		 *
+		 * @param[in] address The address of the memory block.
+		 *
+		 * @return Size storing the usable size of the memory block in bytes.
+		 */
+		Size GetAllocatedSize(VoidPtr address);
+
+		/**
+		 * @brief Checks whether the memory block at the specified address was allocated from the memory pool.
+		 *
+		 * @param[in] address The address of the memory block.
+		 *
+		 * @return True if the address lies within the memory pool, otherwise false.
+		 */
+		Bool Owns(VoidPtr address);
+
+	public:
+		/**
+		 * @brief Initializes a memory pool with the specified capacity using a defined memory policy.
+		 *
+		 * @param capacity The size of the memory pool to initialize in bytes.
+		 */
+		Void Initialize(Size capacity);
+
+		/**
+		 * @brief Initializes a memory pool over the specified memory block, which stays owned by the caller.
+		 *
+		 * @param memory   The memory block to manage. Must be aligned to ALIGNMENT.
+		 * @param capacity The size of the memory block in bytes.
+		 */
+		Void Initialize(VoidPtr memory, Size capacity);
+
+		/**
+		 * @brief Deinitializes the memory pool managed by the defined memory policy.
+		 */
+		Void Deinitialize();
+
+	public:
+		/**
+		 * @brief Allocates a block of memory with the specified size and alignment from the memory pool.
+		 *
+		 * @param[in] size      The size of the memory block to allocate in bytes.
+		 * @param[in] alignment The alignment requirement for the memory block. Must be a power of two.
+		 *
+		 * @return VoidPtr storing the address the allocated memory block, or nullptr if the memory pool is exhausted.
+		 */
+		VoidPtr Allocate(Size size, Size alignment);
+
+		/**
+		 * @brief Allocates a block of memory with the specified size and alignment from the memory pool.
+		 *
+		 * @param[in] size      The size of the memory block to allocate in bytes.
+		 * @param[in] value     The value to set each byte of the memory block to.
+		 * @param[in] alignment The alignment requirement for the memory block. Must be a power of two.
+		 *
+		 * @return VoidPtr storing the address the allocated memory block, or nullptr if the memory pool is exhausted.
+		 */
+		VoidPtr Callocate(Size size, Byte value, Size alignment);
+
+		/**
+		 * @brief Reallocates a block of memory with the specified size and alignment from the memory pool.
+		 *
+		 * The memory block is shrunk in place, or grown in place into its next physical
+		 * neighbour if that neighbour is free and large enough.
+		 *
+		 * @param[in] address   The address of the memory block to reallocate.
+		 * @param[in] size      The size of the memory block to reallocate in bytes.
+		 * @param[in] alignment The alignment requirement for the memory block. Must be a power of two.
+		 *
+		 * @returns VoidPtr storing the address the reallocated memory block, or nullptr if the memory pool is exhausted.
+		 */
+		VoidPtr Reallocate(VoidPtr address, Size size, Size alignment);
+
+	public:
+		/**
+		 * @brief Deallocates a block of memory and coalesces it with its free physical neighbours.
+		 *
+		 * @param[in] address The address of the memory block to deallocate.
+		 */
+		Void Deallocate(VoidPtr address);
+
+	public:
+		/**
+		 * @brief Resets the entire memory pool back to a single free block.
+		 */
+		Void Reset();
+
+	private:
+		static Size GetSize(BlockHeader* block);
+		static Void SetSize(BlockHeader* block, Size size);
+
+		static Bool IsFree(BlockHeader* block);
+		static Bool IsPreviousFree(BlockHeader* block);
+
+		static BlockHeader* GetBlock(VoidPtr address);
+		static Byte*        GetAddress(BlockHeader* block);
+		static BlockHeader* GetNext(BlockHeader* block);
+		static BlockHeader* LinkNext(BlockHeader* block);
+
+		static Void MarkAsFree(BlockHeader* block);
+		static Void MarkAsUsed(BlockHeader* block);
+
+		static Size AdjustRequestSize(Size size, Size alignment);
+
+		static Void MappingInsert(Size size, Size& fl, Size& sl);
+		static Void MappingSearch(Size size, Size& fl, Size& sl);
+
+	private:
+		BlockHeader* SearchSuitableBlock(Size& fl, Size& sl);
+
+		Void InsertFreeBlock(BlockHeader* block, Size fl, Size sl);
+		Void RemoveFreeBlock(BlockHeader* block, Size fl, Size sl);
+
+		Void InsertBlock(BlockHeader* block);
+		Void RemoveBlock(BlockHeader* block);
+
+		BlockHeader* SplitBlock(BlockHeader* block, Size size);
+		BlockHeader* AbsorbBlock(BlockHeader* previous, BlockHeader* block);
+
+		BlockHeader* MergePrevious(BlockHeader* block);
+		BlockHeader* MergeNext(BlockHeader* block);
+
+		Void         TrimFree(BlockHeader* block, Size size);
+		Void         TrimUsed(BlockHeader* block, Size size);
+		BlockHeader* TrimFreeLeading(BlockHeader* block, Size size);
+
+		BlockHeader* LocateFreeBlock(Size size);
+		VoidPtr      PrepareUsedBlock(BlockHeader* block, Size size);
+	};
+}
+
+#include "../Private/Policies/FreeListAllocationPolicy.inl"
+
+#endif
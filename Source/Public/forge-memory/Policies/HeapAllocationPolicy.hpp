@@ -4,20 +4,31 @@
 #include "IAllocationPolicy.hpp"
 
 namespace Forge {
-	class HeapAllocationPolicy : public IAllocationPolicy
+	class HeapAllocationPolicy final : public IAllocationPolicy<HeapAllocationPolicy>
 	{
+	public:
+		static constexpr Size HEADER_SIZE = 16;
+
+	private:
+		// Only used if FORGE_MEMORY_HEAP_SIZE_HEADER is defined, sits right in front of every block.
+		struct SizeHeader
+		{
+			Size m_size;
+			Size m_offset;
+		};
+
 	public:
 		/**
 		 * @brief Initializes a memory pool with the specified capacity using a defined memory policy.
 		 *
 		 * @param capacity The size of the memory pool to initialize in bytes.
 		 */
-		Void Initialize(Size capacity) override;
+		Void Initialize(Size capacity);
 
 		/**
 		 * @brief Deinitializes the memory pool managed by the defined memory policy.
 		 */
-		Void Deinitialize() override;
+		Void Deinitialize();
 
 	public:
 		/**
@@ -28,7 +39,7 @@ namespace Forge {
 		 *
 		 * @return VoidPtr storing the address the allocated memory block.
 		 */
-		VoidPtr Allocate(Size size, Size alignment) override;
+		VoidPtr Allocate(Size size, Size alignment);
 
 		/**
 		 * @brief Allocates a block of memory with the specified size and alignment from the memory pool.
@@ -39,18 +50,32 @@ namespace Forge {
 		 *
 		 * @return VoidPtr storing the address the allocated memory block.
 		 */
-		VoidPtr Callocate(Size size, Byte value, Size alignment) override;
+		VoidPtr Callocate(Size size, Byte value, Size alignment);
+
+		/**
+		 * @brief Allocates a block of memory of at least the specified size and reports how much of it is usable.
+		 *
+		 * The usable size is whatever the heap rounded the request up to, which the size header then records.
+		 *
+		 * @param[in] size      The minimum size of the memory block to allocate in bytes.
+		 * @param[in] alignment The alignment requirement for the memory block. Must be a power of two.
+		 *
+		 * @return AllocationResult storing the address of the allocated memory block and its usable size.
+		 */
+		AllocationResult AllocateAtLeast(Size size, Size alignment);
 
 		/**
 		 * @brief Reallocates a block of memory with the specified size and alignment from the memory pool.
 		 *
+		 * The memory block is grown or shrunk in place whenever the heap allows it, and only copied otherwise.
+		 *
 		 * @param[in] address   The address of the memory block to reallocate.
 		 * @param[in] size      The size of the memory block to reallocate in bytes.
 		 * @param[in] alignment The alignment requirement for the memory block. Must be a power of two.
 		 *
 		 * @returns VoidPtr storing the address the reallocated memory block.
 		 */
-		VoidPtr Reallocate(VoidPtr address, Size size, Size alignment) override;
+		VoidPtr Reallocate(VoidPtr address, Size size, Size alignment);
 
 	public:
 		/**
@@ -58,13 +83,43 @@ namespace Forge {
 		 *
 		 * @param[in] address The address of the memory block to deallocate.
 		 */
-		Void Deallocate(VoidPtr address) override;
+		Void Deallocate(VoidPtr address);
+
+		/**
+		 * @brief Deallocates a block of memory whose size and alignment are known to the caller.
+		 *
+		 * With FORGE_MEMORY_HEAP_SIZE_HEADER defined the start of the allocation follows from the alignment,
+		 * so the size header is never read.
+		 *
+		 * @param[in] address   The address of the memory block to deallocate.
+		 * @param[in] size      The size the memory block was last allocated or reallocated with.
+		 * @param[in] alignment The alignment the memory block was last allocated or reallocated with.
+		 */
+		Void DeallocateSized(VoidPtr address, Size size, Size alignment);
+
+		/**
+		 * @brief Gets the usable size of the memory block at the specified address.
+		 *
+		 * Stores the requested size in a small header in front of every block if FORGE_MEMORY_HEAP_SIZE_HEADER
+		 * is defined, otherwise asks the heap for the usable size of the block.
+		 *
+		 * @param[in] address The address of the memory block.
+		 *
+		 * @return Size storing the size of the memory block in bytes, or zero if the heap cannot report it.
+		 */
+		Size GetAllocatedSize(VoidPtr address);
 
 	public:
 		/**
 		 * @brief Resets the entire memory pool.
 		 */
-		Void Reset() override;
+		Void Reset();
+
+	private:
+		static VoidPtr AllocateBlock(Size size, Size alignment);
+		static VoidPtr ReallocateBlock(VoidPtr address, Size size, Size alignment);
+		static Void    DeallocateBlock(VoidPtr address);
+		static Size    GetUsableSize(VoidPtr address);
 	};
 }
 
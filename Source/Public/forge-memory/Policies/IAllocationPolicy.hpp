@@ -1,76 +1,222 @@
 #ifndef IALLOCATION_POLICY_HPP
 #define IALLOCATION_POLICY_HPP
 
+#include <utility>
+#include <type_traits>
+
 #include <forge-base/Core/Types.hpp>
 #include <forge-base/Core/System.hpp>
 
 namespace Forge {
 	/**
-	 * @brief This interface specifies a class as a defined memory policy to
-	 * allocate and deallocate memory blocks.
+	 * @brief A memory block returned by AllocateAtLeast together with the number of bytes usable in it.
+	 */
+	struct AllocationResult
+	{
+		VoidPtr m_address;
+
+		// At least the requested size, including any slack the memory policy rounded the request up to.
+		Size m_size;
+	};
+
+	/**
+	 * @brief This class specifies a class as a defined memory policy to allocate
+	 * and deallocate memory blocks.
+	 *
+	 * Policies derive from it with themselves as the template argument and are
+	 * dispatched statically, every call inlines into the allocator. A policy must
+	 * provide the following members, which IsAllocationPolicy checks at compile time:
+	 *
+	 * - Void Initialize(Size capacity)
+	 * - Void Deinitialize()
+	 * - VoidPtr Allocate(Size size, Size alignment)
+	 * - VoidPtr Reallocate(VoidPtr address, Size size, Size alignment)
+	 * - Void Deallocate(VoidPtr address)
+	 * - Void Reset()
+	 *
+	 * The remaining members of the contract have defaults here, which a policy may
+	 * hide with its own. Use AnyAllocationPolicy where the policy is only known at
+	 * runtime.
+	 *
+	 * A policy that can tell its own memory blocks apart also provides Bool Owns(VoidPtr address),
+	 * checked by IsOwningAllocationPolicy. Combinators need it to route deallocations.
+	 *
+	 * @tparam InPolicy The type of the memory policy deriving from this class.
 	 */
+	template<typename InPolicy>
 	class IAllocationPolicy
 	{
 	public:
 		/**
-		 * @brief Initializes a memory pool with the specified capacity using a defined memory policy.
+		 * @brief Allocates a block of memory with the specified size and alignment from the memory pool.
+		 *
+		 * Allocates the memory block with Allocate of the memory policy and sets every byte of it.
 		 *
-		 * @param capacity The size of the memory pool to initialize in bytes.
+		 * @param[in] size      The size of the memory block to allocate in bytes.
+		 * @param[in] value     The value to set each byte of the memory block to.
+		 * @param[in] alignment The alignment requirement for the memory block. Must be a power of two.
+		 *
+		 * @return VoidPtr storing the address the allocated memory block.
 		 */
-		virtual Void Initialize(Size capacity) = 0;
+		VoidPtr Callocate(Size size, Byte value, Size alignment);
 
 		/**
-		 * @brief Deinitializes the memory pool managed by the defined memory policy.
+		 * @brief Allocates a block of memory of at least the specified size and reports how much of it is usable.
+		 *
+		 * Allocates the memory block with Allocate of the memory policy and takes the usable size from
+		 * GetAllocatedSize, falling back to the requested size if the memory policy does not track it.
+		 *
+		 * @param[in] size      The minimum size of the memory block to allocate in bytes.
+		 * @param[in] alignment The alignment requirement for the memory block. Must be a power of two.
+		 *
+		 * @return AllocationResult storing the address of the allocated memory block and its usable size, or nullptr and zero on failure.
 		 */
-		virtual Void Deinitialize() = 0;
+		AllocationResult AllocateAtLeast(Size size, Size alignment);
 
-	public:
 		/**
-		 * @brief Allocates a block of memory with the specified size and alignment from the memory pool.
+		 * @brief Allocates a number of memory blocks with the same size and alignment from the memory pool.
 		 *
-		 * @param[in] size      The size of the memory block to allocate in bytes.
-		 * @param[in] alignment The alignment requirement for the memory block. Must be a power of two.
+		 * Calls Allocate of the memory policy once per memory block and stops at the first failure. Policies
+		 * that can hand out several memory blocks at once hide this with their own.
 		 *
-		 * @return VoidPtr storing the address the allocated memory block.
+		 * @param[in]  size      The size of each memory block to allocate in bytes.
+		 * @param[in]  alignment The alignment requirement for each memory block. Must be a power of two.
+		 * @param[in]  count     The number of memory blocks to allocate.
+		 * @param[out] addresses The array receiving the address of each allocated memory block. Must hold count entries.
+		 *
+		 * @return Size storing the number of memory blocks allocated, stored in the first entries of addresses.
 		 */
-		virtual VoidPtr Allocate(Size size, Size alignment) = 0;
+		Size AllocateBatch(Size size, Size alignment, Size count, VoidPtr* addresses);
 
 		/**
-		 * @brief Allocates a block of memory with the specified size and alignment from the memory pool.
+		 * @brief Deallocates a number of memory blocks.
 		 *
-		 * @param[in] size      The size of the memory block to allocate in bytes.
-		 * @param[in] value     The value to set each byte of the memory block to.
-		 * @param[in] alignment The alignment requirement for the memory block. Must be a power of two.
+		 * Calls Deallocate of the memory policy once per memory block. Policies that can take back several
+		 * memory blocks at once hide this with their own.
 		 *
-		 * @return VoidPtr storing the address the allocated memory block.
+		 * @param[in] addresses The array storing the address of each memory block to deallocate.
+		 * @param[in] count     The number of memory blocks to deallocate.
 		 */
-		virtual VoidPtr Callocate(Size size, Byte value, Size alignment) = 0;
+		Void DeallocateBatch(VoidPtr* addresses, Size count);
 
 		/**
-		 * @brief Reallocates a block of memory with the specified size and alignment from the memory pool.
+		 * @brief Deallocates a block of memory whose size and alignment are known to the caller.
 		 *
-		 * @param[in] address   The address of the memory block to reallocate.
-		 * @param[in] size      The size of the memory block to reallocate in bytes.
-		 * @param[in] alignment The alignment requirement for the memory block. Must be a power of two.
+		 * Calls Deallocate of the memory policy. Policies that would otherwise have to look the size of the
+		 * memory block up hide this with their own.
 		 *
-		 * @returns VoidPtr storing the address the reallocated memory block.
+		 * @param[in] address   The address of the memory block to deallocate.
+		 * @param[in] size      The size the memory block was last allocated or reallocated with, or the usable size reported by AllocateAtLeast.
+		 * @param[in] alignment The alignment the memory block was last allocated or reallocated with.
 		 */
-		virtual VoidPtr Reallocate(VoidPtr address, Size size, Size alignment) = 0;
+		Void DeallocateSized(VoidPtr address, Size size, Size alignment);
 
-	public:
 		/**
-		 * @brief Deallocates a block of memory with the specified address from the memory pool.
+		 * @brief Gets the usable size of the memory block at the specified address.
 		 *
-		 * @param[in] address The address of the memory block to deallocate.
+		 * @param[in] address The address of the memory block. Must not have been deallocated yet.
+		 *
+		 * @return Size storing the usable size of the memory block in bytes, or zero if the memory policy does not track block sizes.
 		 */
-		virtual Void Deallocate(VoidPtr address) = 0;
+		Size GetAllocatedSize(VoidPtr address);
 
-	public:
 		/**
-		 * @brief Resets the entire memory pool.
+		 * @brief Gets the usable size of a memory block from the size and alignment it was allocated with.
+		 *
+		 * Calls GetAllocatedSize of the memory policy. Policies that can tell the usable size from the
+		 * requested size alone hide this with their own, so sized deallocations never look the block up.
+		 *
+		 * @param[in] address   The address of the memory block. Must not have been deallocated yet.
+		 * @param[in] size      The size the memory block was last allocated or reallocated with, or the usable size reported by AllocateAtLeast.
+		 * @param[in] alignment The alignment the memory block was last allocated or reallocated with.
+		 *
+		 * @return Size storing the same size GetAllocatedSize reports for the memory block.
+		 */
+		Size GetRoundedSize(VoidPtr address, Size size, Size alignment);
+
+		/**
+		 * @brief Checks whether the memory pool is backed by huge pages.
+		 *
+		 * @returns True if the memory pool is backed by huge pages, otherwise false.
 		 */
-		virtual Void Reset() = 0;
+		Bool IsHugePageBacked() const;
+
+	protected:
+		IAllocationPolicy() = default;
+		~IAllocationPolicy() = default;
 	};
+
+	/**
+	 * @brief Checks at compile time whether a type satisfies the memory policy contract described by IAllocationPolicy.
+	 *
+	 * @tparam InPolicy The type to check.
+	 */
+	template<typename InPolicy, typename = Void>
+	struct IsAllocationPolicy : ::std::false_type {};
+
+	template<typename InPolicy>
+	struct IsAllocationPolicy<InPolicy, ::std::void_t<
+		decltype(::std::declval<InPolicy&>().Initialize(::std::declval<Size>())),
+		decltype(::std::declval<InPolicy&>().Deinitialize()),
+		decltype(::std::declval<InPolicy&>().Allocate(::std::declval<Size>(), ::std::declval<Size>())),
+		decltype(::std::declval<InPolicy&>().Callocate(::std::declval<Size>(), ::std::declval<Byte>(), ::std::declval<Size>())),
+		decltype(::std::declval<InPolicy&>().AllocateAtLeast(::std::declval<Size>(), ::std::declval<Size>())),
+		decltype(::std::declval<InPolicy&>().Reallocate(::std::declval<VoidPtr>(), ::std::declval<Size>(), ::std::declval<Size>())),
+		decltype(::std::declval<InPolicy&>().AllocateBatch(::std::declval<Size>(), ::std::declval<Size>(), ::std::declval<Size>(), ::std::declval<VoidPtr*>())),
+		decltype(::std::declval<InPolicy&>().Deallocate(::std::declval<VoidPtr>())),
+		decltype(::std::declval<InPolicy&>().DeallocateBatch(::std::declval<VoidPtr*>(), ::std::declval<Size>())),
+		decltype(::std::declval<InPolicy&>().DeallocateSized(::std::declval<VoidPtr>(), ::std::declval<Size>(), ::std::declval<Size>())),
+		decltype(::std::declval<InPolicy&>().GetAllocatedSize(::std::declval<VoidPtr>())),
+		decltype(::std::declval<InPolicy&>().GetRoundedSize(::std::declval<VoidPtr>(), ::std::declval<Size>(), ::std::declval<Size>())),
+		decltype(::std::declval<InPolicy&>().Reset()),
+		decltype(::std::declval<const InPolicy&>().IsHugePageBacked())>>
+		: ::std::bool_constant<
+			::std::is_same_v<decltype(::std::declval<InPolicy&>().Allocate(::std::declval<Size>(), ::std::declval<Size>())), VoidPtr> &&
+			::std::is_same_v<decltype(::std::declval<InPolicy&>().Callocate(::std::declval<Size>(), ::std::declval<Byte>(), ::std::declval<Size>())), VoidPtr> &&
+			::std::is_same_v<decltype(::std::declval<InPolicy&>().AllocateAtLeast(::std::declval<Size>(), ::std::declval<Size>())), AllocationResult> &&
+			::std::is_same_v<decltype(::std::declval<InPolicy&>().Reallocate(::std::declval<VoidPtr>(), ::std::declval<Size>(), ::std::declval<Size>())), VoidPtr> &&
+			::std::is_same_v<decltype(::std::declval<InPolicy&>().AllocateBatch(::std::declval<Size>(), ::std::declval<Size>(), ::std::declval<Size>(), ::std::declval<VoidPtr*>())), Size> &&
+			::std::is_same_v<decltype(::std::declval<InPolicy&>().GetAllocatedSize(::std::declval<VoidPtr>())), Size> &&
+			::std::is_same_v<decltype(::std::declval<InPolicy&>().GetRoundedSize(::std::declval<VoidPtr>(), ::std::declval<Size>(), ::std::declval<Size>())), Size> &&
+			::std::is_same_v<decltype(::std::declval<const InPolicy&>().IsHugePageBacked()), Bool> &&
+			::std::is_default_constructible_v<InPolicy>> {};
+
+	/**
+	 * @brief Checks at compile time whether a memory policy can tell whether it allocated a memory block.
+	 *
+	 * @tparam InPolicy The type to check.
+	 */
+	template<typename InPolicy, typename = Void>
+	struct IsOwningAllocationPolicy : ::std::false_type {};
+
+	template<typename InPolicy>
+	struct IsOwningAllocationPolicy<InPolicy, ::std::void_t<decltype(::std::declval<InPolicy&>().Owns(::std::declval<VoidPtr>()))>>
+		: ::std::bool_constant<
+			IsAllocationPolicy<InPolicy>::value &&
+			::std::is_same_v<decltype(::std::declval<InPolicy&>().Owns(::std::declval<VoidPtr>())), Bool>> {};
+
+	/**
+	 * @brief Moves a memory block from one memory policy to another, used by combinators to reallocate between their sub-policies.
+	 *
+	 * The memory block is only moved if the number of bytes to keep is known, either from GetAllocatedSize of
+	 * the source or from the minimum size the caller knows the memory block has.
+	 *
+	 * @tparam InSource The type of memory policy the memory block was allocated from.
+	 * @tparam InDestination The type of memory policy to move the memory block to.
+	 *
+	 * @param[in] source        The memory policy the memory block was allocated from.
+	 * @param[in] destination   The memory policy to move the memory block to.
+	 * @param[in] address       The address of the memory block to move.
+	 * @param[in] size          The size of the moved memory block in bytes.
+	 * @param[in] alignment     The alignment requirement for the moved memory block. Must be a power of two.
+	 * @param[in] min_old_size  The size the memory block is known to have at least in bytes.
+	 *
+	 * @return VoidPtr storing the address of the moved memory block, or nullptr if the memory block was left untouched.
+	 */
+	template<typename InSource, typename InDestination>
+	VoidPtr ReallocateAcross(InSource& source, InDestination& destination, VoidPtr address, Size size, Size alignment, Size min_old_size);
 }
 
-#endif
\ No newline at end of file
+#include "../Private/Policies/IAllocationPolicy.inl"
+
+#endif
@@ -0,0 +1,123 @@
+#ifndef LINEAR_ALLOCATION_POLICY_HPP
+#define LINEAR_ALLOCATION_POLICY_HPP
+
+#include "IAllocationPolicy.hpp"
+
+namespace Forge {
+	/**
+	 * @brief This policy serves allocations from a fixed memory pool by bumping
+	 * a pointer forward. Individual memory blocks are never freed, the entire
+	 * memory pool is released at once on reset.
+	 */
+	class LinearAllocationPolicy final : public IAllocationPolicy<LinearAllocationPolicy>
+	{
+	private:
+		Byte* m_start;
+		Size  m_offset;
+		Size  m_capacity;
+
+	private:
+		VoidPtr m_last_address;
+
+	public:
+		LinearAllocationPolicy();
+
+	public:
+		/**
+		 * @brief Initializes a memory pool with the specified capacity using a defined memory policy.
+		 *
+		 * @param capacity The size of the memory pool to initialize in bytes.
+		 */
+		Void Initialize(Size capacity);
+
+		/**
+		 * @brief Deinitializes the memory pool managed by the defined memory policy.
+		 */
+		Void Deinitialize();
+
+	public:
+		/**
+		 * @brief Allocates a block of memory with the specified size and alignment from the memory pool.
+		 *
+		 * @param[in] size      The size of the memory block to allocate in bytes.
+		 * @param[in] alignment The alignment requirement for the memory block. Must be a power of two.
+		 *
+		 * @return VoidPtr storing the address the allocated memory block, or nullptr if the memory pool is exhausted.
+		 */
+		VoidPtr Allocate(Size size, Size alignment);
+
+		/**
+		 * @brief Allocates a block of memory with the specified size and alignment from the memory pool.
+		 *
+		 * @param[in] size      The size of the memory block to allocate in bytes.
+		 * @param[in] value     The value to set each byte of the memory block to.
+		 * @param[in] alignment The alignment requirement for the memory block. Must be a power of two.
+		 *
+		 * @return VoidPtr storing the address the allocated memory block, or nullptr if the memory pool is exhausted.
+		 */
+		VoidPtr Callocate(Size size, Byte value, Size alignment);
+
+		/**
+		 * @brief Reallocates a block of memory with the specified size and alignment from the memory pool.
+		 *
+		 * If the memory block is the most recent allocation, it is resized in place.
+		 *
+		 * @param[in] address   The address of the memory block to reallocate.
+		 * @param[in] size      The size of the memory block to reallocate in bytes.
+		 * @param[in] alignment The alignment requirement for the memory block. Must be a power of two.
+		 *
+		 * @returns VoidPtr storing the address the reallocated memory block, or nullptr if the memory pool is exhausted.
+		 */
+		VoidPtr Reallocate(VoidPtr address, Size size, Size alignment);
+
+		/**
+		 * @brief Allocates a number of memory blocks with the same size and alignment with a single bump.
+		 *
+		 * @param[in]  size      The size of each memory block to allocate in bytes.
+		 * @param[in]  alignment The alignment requirement for each memory block. Must be a power of two.
+		 * @param[in]  count     The number of memory blocks to allocate.
+		 * @param[out] addresses The array receiving the address of each allocated memory block. Must hold count entries.
+		 *
+		 * @return Size storing the number of memory blocks allocated, fewer than count if the memory pool is exhausted.
+		 */
+		Size AllocateBatch(Size size, Size alignment, Size count, VoidPtr* addresses);
+
+	public:
+		/**
+		 * @brief Does nothing, memory blocks are only released on reset.
+		 *
+		 * @param[in] address The address of the memory block to deallocate.
+		 */
+		Void Deallocate(VoidPtr address);
+
+		/**
+		 * @brief Gets the size of the memory block at the specified address.
+		 *
+		 * Only the last allocated memory block has a known size, which is the one reallocated in place.
+		 *
+		 * @param[in] address The address of the memory block.
+		 *
+		 * @return Size storing the size of the memory block in bytes, or zero if it is not the last allocated memory block.
+		 */
+		Size GetAllocatedSize(VoidPtr address);
+
+		/**
+		 * @brief Checks whether the memory block at the specified address was allocated from the memory pool.
+		 *
+		 * @param[in] address The address of the memory block.
+		 *
+		 * @return True if the address lies within the memory pool, otherwise false.
+		 */
+		Bool Owns(VoidPtr address);
+
+	public:
+		/**
+		 * @brief Resets the entire memory pool by rewinding the bump pointer.
+		 */
+		Void Reset();
+	};
+}
+
+#include "../Private/Policies/LinearAllocationPolicy.inl"
+
+#endif
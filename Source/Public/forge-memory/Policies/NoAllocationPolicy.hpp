@@ -4,7 +4,7 @@
 #include "IAllocationPolicy.hpp"
 
 namespace Forge {
-	class NoAllocationPolicy : public IAllocationPolicy
+	class NoAllocationPolicy final : public IAllocationPolicy<NoAllocationPolicy>
 	{
 	public:
 		/**
@@ -12,12 +12,12 @@ namespace Forge {
 		 *
 		 * @param capacity The size of the memory pool to initialize in bytes.
 		 */
-		Void Initialize(Size capacity) override;
+		Void Initialize(Size capacity);
 
 		/**
 		 * @brief Deinitializes the memory pool managed by the defined memory policy.
 		 */
-		Void Deinitialize() override;
+		Void Deinitialize();
 
 	public:
 		/**
@@ -28,7 +28,7 @@ namespace Forge {
 		 *
 		 * @return VoidPtr storing the address the allocated memory block.
 		 */
-		VoidPtr Allocate(Size size, Size alignment) override;
+		VoidPtr Allocate(Size size, Size alignment);
 
 		/**
 		 * @brief Allocates a block of memory with the specified size and alignment from the memory pool.
@@ -39,7 +39,17 @@ namespace Forge {
 		 *
 		 * @return VoidPtr storing the address the allocated memory block.
 		 */
-		VoidPtr Callocate(Size size, Byte value, Size alignment) override;
+		VoidPtr Callocate(Size size, Byte value, Size alignment);
+
+		/**
+		 * @brief Does nothing, no memory blocks are ever allocated.
+		 *
+		 * @param[in] size      The minimum size of the memory block to allocate in bytes.
+		 * @param[in] alignment The alignment requirement for the memory block. Must be a power of two.
+		 *
+		 * @return AllocationResult storing nullptr and zero.
+		 */
+		AllocationResult AllocateAtLeast(Size size, Size alignment);
 
 		/**
 		 * @brief Reallocates a block of memory with the specified size and alignment from the memory pool.
@@ -50,7 +60,7 @@ namespace Forge {
 		 *
 		 * @returns VoidPtr storing the address the reallocated memory block.
 		 */
-		VoidPtr Reallocate(VoidPtr address, Size size, Size alignment) override;
+		VoidPtr Reallocate(VoidPtr address, Size size, Size alignment);
 
 	public:
 		/**
@@ -58,13 +68,40 @@ namespace Forge {
 		 *
 		 * @param[in] address The address of the memory block to deallocate.
 		 */
-		Void Deallocate(VoidPtr address) override;
+		Void Deallocate(VoidPtr address);
+
+		/**
+		 * @brief Does nothing, no memory blocks are ever allocated.
+		 *
+		 * @param[in] address   The address of the memory block to deallocate.
+		 * @param[in] size      The size the memory block was allocated with.
+		 * @param[in] alignment The alignment the memory block was allocated with.
+		 */
+		Void DeallocateSized(VoidPtr address, Size size, Size alignment);
+
+		/**
+		 * @brief Does nothing, no memory blocks are ever allocated.
+		 *
+		 * @param[in] address The address of the memory block.
+		 *
+		 * @return Size storing zero.
+		 */
+		Size GetAllocatedSize(VoidPtr address);
+
+		/**
+		 * @brief Checks whether the memory block at the specified address was allocated from the memory pool.
+		 *
+		 * @param[in] address The address of the memory block.
+		 *
+		 * @return False, no memory block is ever allocated.
+		 */
+		Bool Owns(VoidPtr address);
 
 	public:
 		/**
 		 * @brief Resets the entire memory pool.
 		 */
-		Void Reset() override;
+		Void Reset();
 	};
 }
 
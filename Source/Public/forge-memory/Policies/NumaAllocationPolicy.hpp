@@ -0,0 +1,174 @@
+#ifndef NUMA_ALLOCATION_POLICY_HPP
+#define NUMA_ALLOCATION_POLICY_HPP
+
+#include <mutex>
+#include <memory>
+
+#include "IAllocationPolicy.hpp"
+#include "FreeListAllocationPolicy.hpp"
+
+namespace Forge {
+	/**
+	 * @brief This policy keeps one arena per NUMA node and serves every thread from
+	 * the arena of the node it currently runs on.
+	 *
+	 * The memory pool is a single reserved address range split into one slice per
+	 * node, each slice bound to its node and managed by a FreeListAllocationPolicy
+	 * under its own lock. A block is always returned to the arena it came from,
+	 * whichever thread frees it. If the local arena is exhausted the other nodes
+	 * are tried in turn. On systems with a single node, or without NUMA support,
+	 * the policy degrades to a single arena.
+	 */
+	class NumaAllocationPolicy final : public IAllocationPolicy<NumaAllocationPolicy>
+	{
+	public:
+		static constexpr Size MAX_NUM_OF_NODES = 64;
+
+		// The number of allocations a thread makes before it checks again which node it runs on.
+		static constexpr Size NODE_REFRESH_INTERVAL = 256;
+
+	private:
+		struct alignas(64) NodeArena
+		{
+			::std::mutex             m_mutex;
+			FreeListAllocationPolicy m_allocation_policy;
+		};
+
+		struct ThreadNode
+		{
+			Size m_node;
+			Size m_countdown;
+		};
+
+	private:
+		static inline thread_local ThreadNode s_thread_node{ 0, 0 };
+
+	private:
+		Byte* m_start;
+		Size  m_capacity;
+		Size  m_node_capacity;
+		Size  m_num_of_nodes;
+
+		::std::unique_ptr<NodeArena[]> m_node_arenas;
+
+	public:
+		NumaAllocationPolicy();
+
+	public:
+		/**
+		 * @brief Gets the number of NUMA nodes the memory pool is split across.
+		 *
+		 * @return Size storing the number of node arenas.
+		 */
+		Size GetNumOfNodes() const;
+
+		/**
+		 * @brief Gets the NUMA node the memory block at the specified address belongs to.
+		 *
+		 * @param[in] address The address of the memory block. Must have been allocated by this policy.
+		 *
+		 * @return Size storing the index of the node arena owning the memory block.
+		 */
+		Size GetNode(VoidPtr address) const;
+
+	public:
+		/**
+		 * @brief Initializes a memory pool with the specified capacity using a defined memory policy.
+		 *
+		 * @param capacity The size of the memory pool to initialize in bytes, split evenly across the nodes.
+		 */
+		Void Initialize(Size capacity);
+
+		/**
+		 * @brief Deinitializes the memory pool managed by the defined memory policy.
+		 */
+		Void Deinitialize();
+
+	public:
+		/**
+		 * @brief Allocates a block of memory with the specified size and alignment from the arena of the current node.
+		 *
+		 * @param[in] size      The size of the memory block to allocate in bytes.
+		 * @param[in] alignment The alignment requirement for the memory block. Must be a power of two.
+		 *
+		 * @return VoidPtr storing the address the allocated memory block, or nullptr if the memory pool is exhausted.
+		 */
+		VoidPtr Allocate(Size size, Size alignment);
+
+		/**
+		 * @brief Allocates a block of memory with the specified size and alignment from the arena of the specified node.
+		 *
+		 * Unlike the other overload, never falls back to the arena of another node.
+		 *
+		 * @param[in] size      The size of the memory block to allocate in bytes.
+		 * @param[in] alignment The alignment requirement for the memory block. Must be a power of two.
+		 * @param[in] node      The index of the node to allocate from. Must be less than GetNumOfNodes().
+		 *
+		 * @return VoidPtr storing the address the allocated memory block, or nullptr if the arena of the node is exhausted.
+		 */
+		VoidPtr Allocate(Size size, Size alignment, Size node);
+
+		/**
+		 * @brief Allocates a block of memory with the specified size and alignment from the arena of the current node.
+		 *
+		 * @param[in] size      The size of the memory block to allocate in bytes.
+		 * @param[in] value     The value to set each byte of the memory block to.
+		 * @param[in] alignment The alignment requirement for the memory block. Must be a power of two.
+		 *
+		 * @return VoidPtr storing the address the allocated memory block, or nullptr if the memory pool is exhausted.
+		 */
+		VoidPtr Callocate(Size size, Byte value, Size alignment);
+
+		/**
+		 * @brief Reallocates a block of memory with the specified size and alignment.
+		 *
+		 * The memory block stays in the arena of its node if that arena has room for it.
+		 *
+		 * @param[in] address   The address of the memory block to reallocate.
+		 * @param[in] size      The size of the memory block to reallocate in bytes.
+		 * @param[in] alignment The alignment requirement for the memory block. Must be a power of two.
+		 *
+		 * @returns VoidPtr storing the address the reallocated memory block, or nullptr if the memory pool is exhausted.
+		 */
+		VoidPtr Reallocate(VoidPtr address, Size size, Size alignment);
+
+	public:
+		/**
+		 * @brief Deallocates a block of memory, returning it to the arena of the node it belongs to.
+		 *
+		 * @param[in] address The address of the memory block to deallocate.
+		 */
+		Void Deallocate(VoidPtr address);
+
+		/**
+		 * @brief Gets the usable size of the memory block at the specified address.
+		 *
+		 * @param[in] address The address of the memory block.
+		 *
+		 * @return Size storing the usable size of the memory block in bytes.
+		 */
+		Size GetAllocatedSize(VoidPtr address);
+
+		/**
+		 * @brief Checks whether the memory block at the specified address was allocated from the memory pool.
+		 *
+		 * @param[in] address The address of the memory block.
+		 *
+		 * @return True if the address lies within the memory pool, otherwise false.
+		 */
+		Bool Owns(VoidPtr address);
+
+	public:
+		/**
+		 * @brief Resets the entire memory pool, emptying the arena of every node.
+		 */
+		Void Reset();
+
+	private:
+		Size GetCurrentNode();
+	};
+}
+
+#include "../Private/Policies/NumaAllocationPolicy.inl"
+
+#endif
@@ -0,0 +1,193 @@
+#ifndef SEGREGATOR_ALLOCATION_POLICY_HPP
+#define SEGREGATOR_ALLOCATION_POLICY_HPP
+
+#include <type_traits>
+
+#include "IAllocationPolicy.hpp"
+
+namespace Forge {
+	/**
+	 * @brief This policy routes requests up to a threshold size to one memory
+	 * policy and larger requests to another.
+	 *
+	 * The routing of allocations is resolved at compile time down to a single size
+	 * comparison. Deallocations are routed by asking whichever memory policy can
+	 * tell its own memory blocks apart. Both memory policies are initialized with
+	 * the full capacity, use GetSmall and GetLarge to initialize them separately.
+	 *
+	 * @tparam Threshold The largest request served by the small memory policy in bytes.
+	 * @tparam Small The memory policy serving requests up to the threshold.
+	 * @tparam Large The memory policy serving requests above the threshold.
+	 */
+	template<Size Threshold, typename Small, typename Large>
+	class SegregatorAllocationPolicy final : public IAllocationPolicy<SegregatorAllocationPolicy<Threshold, Small, Large>>
+	{
+		static_assert(IsAllocationPolicy<Small>::value, "Small does not satisfy the memory policy contract of IAllocationPolicy");
+		static_assert(IsAllocationPolicy<Large>::value, "Large does not satisfy the memory policy contract of IAllocationPolicy");
+		static_assert(IsOwningAllocationPolicy<Small>::value || IsOwningAllocationPolicy<Large>::value, "Small or Large must provide Owns to route deallocations");
+
+	private:
+		Small m_small;
+		Large m_large;
+
+	public:
+		/**
+		 * @brief Gets the memory policy serving requests up to the threshold.
+		 *
+		 * @return Small& storing the small memory policy.
+		 */
+		Small& GetSmall();
+
+		/**
+		 * @brief Gets the memory policy serving requests above the threshold.
+		 *
+		 * @return Large& storing the large memory policy.
+		 */
+		Large& GetLarge();
+
+	public:
+		/**
+		 * @brief Initializes both memory policies with the specified capacity.
+		 *
+		 * @param capacity The size of the memory pool of each memory policy in bytes.
+		 */
+		Void Initialize(Size capacity);
+
+		/**
+		 * @brief Deinitializes both memory policies.
+		 */
+		Void Deinitialize();
+
+	public:
+		/**
+		 * @brief Allocates a block of memory from the memory policy serving the specified size.
+		 *
+		 * @param[in] size      The size of the memory block to allocate in bytes.
+		 * @param[in] alignment The alignment requirement for the memory block. Must be a power of two.
+		 *
+		 * @return VoidPtr storing the address the allocated memory block.
+		 */
+		VoidPtr Allocate(Size size, Size alignment);
+
+		/**
+		 * @brief Allocates a block of memory from the memory policy serving the specified size.
+		 *
+		 * @param[in] size      The size of the memory block to allocate in bytes.
+		 * @param[in] value     The value to set each byte of the memory block to.
+		 * @param[in] alignment The alignment requirement for the memory block. Must be a power of two.
+		 *
+		 * @return VoidPtr storing the address the allocated memory block.
+		 */
+		VoidPtr Callocate(Size size, Byte value, Size alignment);
+
+		/**
+		 * @brief Allocates a block of memory of at least the specified size from the memory policy serving that size.
+		 *
+		 * The usable size reported for a small memory block never exceeds the threshold, so a sized
+		 * deallocation with it is routed back to the small memory policy.
+		 *
+		 * @param[in] size      The minimum size of the memory block to allocate in bytes.
+		 * @param[in] alignment The alignment requirement for the memory block. Must be a power of two.
+		 *
+		 * @return AllocationResult storing the address of the allocated memory block and its usable size.
+		 */
+		AllocationResult AllocateAtLeast(Size size, Size alignment);
+
+		/**
+		 * @brief Reallocates a block of memory, moving it to the other memory policy if the new size crosses the threshold.
+		 *
+		 * @param[in] address   The address of the memory block to reallocate.
+		 * @param[in] size      The size of the memory block to reallocate in bytes.
+		 * @param[in] alignment The alignment requirement for the memory block. Must be a power of two.
+		 *
+		 * @returns VoidPtr storing the address the reallocated memory block.
+		 */
+		VoidPtr Reallocate(VoidPtr address, Size size, Size alignment);
+
+		/**
+		 * @brief Allocates a number of memory blocks from the memory policy serving the specified size.
+		 *
+		 * @param[in]  size      The size of each memory block to allocate in bytes.
+		 * @param[in]  alignment The alignment requirement for each memory block. Must be a power of two.
+		 * @param[in]  count     The number of memory blocks to allocate.
+		 * @param[out] addresses The array receiving the address of each allocated memory block. Must hold count entries.
+		 *
+		 * @return Size storing the number of memory blocks allocated, fewer than count if the memory policy is exhausted.
+		 */
+		Size AllocateBatch(Size size, Size alignment, Size count, VoidPtr* addresses);
+
+	public:
+		/**
+		 * @brief Deallocates a block of memory using the memory policy that owns it.
+		 *
+		 * @param[in] address The address of the memory block to deallocate.
+		 */
+		Void Deallocate(VoidPtr address);
+
+		/**
+		 * @brief Deallocates a block of memory whose size and alignment are known to the caller.
+		 *
+		 * The memory policy is picked by comparing the size against the threshold, so neither is asked for ownership.
+		 *
+		 * @param[in] address   The address of the memory block to deallocate.
+		 * @param[in] size      The size the memory block was last allocated or reallocated with.
+		 * @param[in] alignment The alignment the memory block was last allocated or reallocated with.
+		 */
+		Void DeallocateSized(VoidPtr address, Size size, Size alignment);
+
+		/**
+		 * @brief Gets the usable size of the memory block at the specified address.
+		 *
+		 * @param[in] address The address of the memory block.
+		 *
+		 * @return Size storing the usable size reported by the memory policy that owns the memory block in bytes.
+		 */
+		Size GetAllocatedSize(VoidPtr address);
+
+		/**
+		 * @brief Gets the usable size of a memory block from the size and alignment it was allocated with.
+		 *
+		 * The memory policy is picked by comparing the size against the threshold, so neither is asked for ownership.
+		 *
+		 * @param[in] address   The address of the memory block.
+		 * @param[in] size      The size the memory block was last allocated or reallocated with.
+		 * @param[in] alignment The alignment the memory block was last allocated or reallocated with.
+		 *
+		 * @return Size storing the usable size reported by the memory policy that owns the memory block in bytes.
+		 */
+		Size GetRoundedSize(VoidPtr address, Size size, Size alignment);
+
+		/**
+		 * @brief Checks whether the memory block at the specified address was allocated from either memory policy.
+		 *
+		 * Only available if both memory policies can tell their own memory blocks apart.
+		 *
+		 * @param[in] address The address of the memory block.
+		 *
+		 * @return True if either memory policy owns the memory block, otherwise false.
+		 */
+		template<typename InSmall = Small, typename = ::std::enable_if_t<IsOwningAllocationPolicy<InSmall>::value && IsOwningAllocationPolicy<Large>::value>>
+		Bool Owns(VoidPtr address);
+
+	public:
+		/**
+		 * @brief Resets the memory pools of both memory policies.
+		 */
+		Void Reset();
+
+	public:
+		/**
+		 * @brief Checks whether the memory pools of both memory policies are backed by huge pages.
+		 *
+		 * @returns True if both memory pools are backed by huge pages, otherwise false.
+		 */
+		Bool IsHugePageBacked() const;
+
+	private:
+		Bool IsSmall(VoidPtr address);
+	};
+}
+
+#include "../Private/Policies/SegregatorAllocationPolicy.inl"
+
+#endif
@@ -0,0 +1,188 @@
+#ifndef SIZE_CLASS_ALLOCATION_POLICY_HPP
+#define SIZE_CLASS_ALLOCATION_POLICY_HPP
+
+#include "IAllocationPolicy.hpp"
+#include "HeapAllocationPolicy.hpp"
+
+#include <forge-memory/SizeClassTable.hpp>
+
+namespace Forge {
+	/**
+	 * @brief This policy rounds every request up to a size class from a compile-time
+	 * table and serves it from slabs dedicated to that size class. Requests larger
+	 * than the largest size class fall through to the backing policy.
+	 *
+	 * @tparam MaxSize The largest request served from slabs in bytes.
+	 * @tparam BackingPolicy The memory policy slabs and large requests are allocated from.
+	 */
+	template<Size MaxSize = 32768, typename BackingPolicy = HeapAllocationPolicy>
+	class SizeClassAllocationPolicy final : public IAllocationPolicy<SizeClassAllocationPolicy<MaxSize, BackingPolicy>>
+	{
+		static_assert(MaxSize >= 128, "The maximum size class must be at least 128 bytes");
+
+	public:
+		static constexpr Size HEADER_SIZE = 64;
+		static constexpr Size SLAB_SIZE = NextPowerOfTwo(MaxSize * 8) < 65536 ? 65536 : NextPowerOfTwo(MaxSize * 8);
+		static constexpr Size LARGE_CLASS = ~static_cast<Size>(0);
+
+	private:
+		struct Slab
+		{
+			Slab* m_next;
+			Slab* m_previous;
+			Size  m_class_index;
+			Size  m_block_size;
+		};
+
+		struct FreeBlock
+		{
+			FreeBlock* m_next;
+		};
+
+		struct SizeClass
+		{
+			FreeBlock* m_free_list;
+			Byte*      m_current;
+			Byte*      m_end;
+		};
+
+		static_assert(sizeof(Slab) <= HEADER_SIZE, "The slab header must fit in the reserved header space");
+
+	public:
+		static constexpr Size NUM_OF_SIZE_CLASSES = SizeClassTable<MaxSize>::GetNumOfSizeClasses();
+		static constexpr ::std::array<Size, NUM_OF_SIZE_CLASSES> SIZE_CLASSES = SizeClassTable<MaxSize>::GenerateSizeClasses();
+
+	private:
+		SizeClass m_size_classes[NUM_OF_SIZE_CLASSES];
+
+	private:
+		Slab* m_slabs;
+		Slab* m_large_blocks;
+
+	private:
+		BackingPolicy m_backing_policy;
+
+	public:
+		SizeClassAllocationPolicy();
+
+	public:
+		/**
+		 * @brief Gets the usable size of the memory block at the specified address.
+		 *
+		 * @param[in] address The address of the memory block.
+		 *
+		 * @return Size storing the size of the size class or large block the address belongs to in bytes.
+		 */
+		Size GetAllocatedSize(VoidPtr address);
+
+		/**
+		 * @brief Gets the usable size of a memory block from the size and alignment it was allocated with.
+		 *
+		 * The size class follows from the size and alignment, and large blocks are exactly as large as requested,
+		 * so the slab header is never read.
+		 *
+		 * @param[in] address   The address of the memory block.
+		 * @param[in] size      The size the memory block was last allocated or reallocated with.
+		 * @param[in] alignment The alignment the memory block was last allocated or reallocated with.
+		 *
+		 * @return Size storing the size of the size class or large block the memory block belongs to in bytes.
+		 */
+		Size GetRoundedSize(VoidPtr address, Size size, Size alignment);
+
+	public:
+		/**
+		 * @brief Initializes a memory pool with the specified capacity using a defined memory policy.
+		 *
+		 * @param capacity The size of the memory pool to initialize in bytes, forwarded to the backing policy.
+		 */
+		Void Initialize(Size capacity);
+
+		/**
+		 * @brief Deinitializes the memory pool managed by the defined memory policy.
+		 */
+		Void Deinitialize();
+
+	public:
+		/**
+		 * @brief Allocates a block of memory with the specified size and alignment from the memory pool.
+		 *
+		 * @param[in] size      The size of the memory block to allocate in bytes.
+		 * @param[in] alignment The alignment requirement for the memory block. Must be a power of two.
+		 *
+		 * @return VoidPtr storing the address the allocated memory block, or nullptr if the memory pool is exhausted.
+		 */
+		VoidPtr Allocate(Size size, Size alignment);
+
+		/**
+		 * @brief Allocates a block of memory with the specified size and alignment from the memory pool.
+		 *
+		 * @param[in] size      The size of the memory block to allocate in bytes.
+		 * @param[in] value     The value to set each byte of the memory block to.
+		 * @param[in] alignment The alignment requirement for the memory block. Must be a power of two.
+		 *
+		 * @return VoidPtr storing the address the allocated memory block, or nullptr if the memory pool is exhausted.
+		 */
+		VoidPtr Callocate(Size size, Byte value, Size alignment);
+
+		/**
+		 * @brief Reallocates a block of memory with the specified size and alignment from the memory pool.
+		 *
+		 * The memory block is returned as is if the new size still fits its size class.
+		 *
+		 * @param[in] address   The address of the memory block to reallocate.
+		 * @param[in] size      The size of the memory block to reallocate in bytes.
+		 * @param[in] alignment The alignment requirement for the memory block. Must be a power of two.
+		 *
+		 * @returns VoidPtr storing the address the reallocated memory block, or nullptr if the memory pool is exhausted.
+		 */
+		VoidPtr Reallocate(VoidPtr address, Size size, Size alignment);
+
+		/**
+		 * @brief Allocates a number of memory blocks with the same size and alignment from the memory pool.
+		 *
+		 * The size class is resolved once, then blocks are unlinked from its free list and carved from its slabs.
+		 *
+		 * @param[in]  size      The size of each memory block to allocate in bytes.
+		 * @param[in]  alignment The alignment requirement for each memory block. Must be a power of two.
+		 * @param[in]  count     The number of memory blocks to allocate.
+		 * @param[out] addresses The array receiving the address of each allocated memory block. Must hold count entries.
+		 *
+		 * @return Size storing the number of memory blocks allocated, fewer than count if the memory pool is exhausted.
+		 */
+		Size AllocateBatch(Size size, Size alignment, Size count, VoidPtr* addresses);
+
+	public:
+		/**
+		 * @brief Deallocates a block of memory with the specified address from the memory pool.
+		 *
+		 * @param[in] address The address of the memory block to deallocate.
+		 */
+		Void Deallocate(VoidPtr address);
+
+		/**
+		 * @brief Deallocates a block of memory whose size and alignment are known to the caller from the memory pool.
+		 *
+		 * The size class follows from the size and alignment, so the slab header is only read for large blocks.
+		 *
+		 * @param[in] address   The address of the memory block to deallocate.
+		 * @param[in] size      The size the memory block was last allocated or reallocated with.
+		 * @param[in] alignment The alignment the memory block was last allocated or reallocated with.
+		 */
+		Void DeallocateSized(VoidPtr address, Size size, Size alignment);
+
+	public:
+		/**
+		 * @brief Resets the entire memory pool, returning every slab and large block to the backing policy.
+		 */
+		Void Reset();
+
+	private:
+		Slab* GetSlab(VoidPtr address);
+		Size  GetClassIndex(Size size, Size alignment);
+		Bool  RefillSizeClass(Size class_index);
+	};
+}
+
+#include "../Private/Policies/SizeClassAllocationPolicy.inl"
+
+#endif
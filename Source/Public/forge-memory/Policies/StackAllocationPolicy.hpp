@@ -0,0 +1,189 @@
+#ifndef STACK_ALLOCATION_POLICY_HPP
+#define STACK_ALLOCATION_POLICY_HPP
+
+#include "IAllocationPolicy.hpp"
+
+namespace Forge {
+	/**
+	 * @brief Specifies which end of a double-ended stack memory blocks are allocated from.
+	 */
+	enum class StackEnd
+	{
+		Bottom,
+		Top
+	};
+
+	/**
+	 * @brief This policy serves allocations from both ends of a fixed memory pool.
+	 * The bottom end grows upwards and the top end grows downwards, memory blocks
+	 * are released in LIFO order per end or all at once by rolling back to a marker.
+	 */
+	class StackAllocationPolicy final : public IAllocationPolicy<StackAllocationPolicy>
+	{
+	public:
+		/**
+		 * @brief Stores the state of both ends of the stack at a point in time.
+		 */
+		struct Marker
+		{
+			Size  m_bottom;
+			Size  m_top;
+			Byte* m_bottom_last;
+			Byte* m_top_last;
+		};
+
+	private:
+		struct Header
+		{
+			Size  m_previous_offset;
+			Byte* m_previous_last;
+		};
+
+	private:
+		Byte* m_start;
+		Size  m_capacity;
+
+	private:
+		Size  m_bottom;
+		Size  m_top;
+		Byte* m_bottom_last;
+		Byte* m_top_last;
+
+	private:
+		StackEnd m_allocation_end;
+
+	public:
+		StackAllocationPolicy();
+
+	public:
+		/**
+		 * @brief Sets the end of the stack subsequent allocations are served from.
+		 *
+		 * @param[in] end The end of the stack to allocate from.
+		 */
+		Void SetAllocationEnd(StackEnd end);
+
+		/**
+		 * @brief Gets the end of the stack allocations are currently served from.
+		 *
+		 * @return StackEnd storing the end of the stack allocations are served from.
+		 */
+		StackEnd GetAllocationEnd();
+
+	public:
+		/**
+		 * @brief Gets a marker storing the current state of both ends of the stack.
+		 *
+		 * @return Marker storing the current state of the stack.
+		 */
+		Marker GetMarker();
+
+		/**
+		 * @brief Releases every memory block allocated after the specified marker was taken.
+		 *
+		 * Bypasses the statistics of an Allocator, use Allocator::FreeToMarker to have the released memory blocks recorded.
+		 *
+		 * @param[in] marker The marker to roll the stack back to.
+		 */
+		Void FreeToMarker(const Marker& marker);
+
+	public:
+		/**
+		 * @brief Initializes a memory pool with the specified capacity using a defined memory policy.
+		 *
+		 * @param capacity The size of the memory pool to initialize in bytes.
+		 */
+		Void Initialize(Size capacity);
+
+		/**
+		 * @brief Deinitializes the memory pool managed by the defined memory policy.
+		 */
+		Void Deinitialize();
+
+	public:
+		/**
+		 * @brief Allocates a block of memory with the specified size and alignment from the memory pool.
+		 *
+		 * @param[in] size      The size of the memory block to allocate in bytes.
+		 * @param[in] alignment The alignment requirement for the memory block. Must be a power of two.
+		 *
+		 * @return VoidPtr storing the address the allocated memory block, or nullptr if the memory pool is exhausted.
+		 */
+		VoidPtr Allocate(Size size, Size alignment);
+
+		/**
+		 * @brief Allocates a block of memory with the specified size and alignment from the specified end of the memory pool.
+		 *
+		 * @param[in] size      The size of the memory block to allocate in bytes.
+		 * @param[in] alignment The alignment requirement for the memory block. Must be a power of two.
+		 * @param[in] end       The end of the stack to allocate from.
+		 *
+		 * @return VoidPtr storing the address the allocated memory block, or nullptr if the memory pool is exhausted.
+		 */
+		VoidPtr Allocate(Size size, Size alignment, StackEnd end);
+
+		/**
+		 * @brief Allocates a block of memory with the specified size and alignment from the memory pool.
+		 *
+		 * @param[in] size      The size of the memory block to allocate in bytes.
+		 * @param[in] value     The value to set each byte of the memory block to.
+		 * @param[in] alignment The alignment requirement for the memory block. Must be a power of two.
+		 *
+		 * @return VoidPtr storing the address the allocated memory block, or nullptr if the memory pool is exhausted.
+		 */
+		VoidPtr Callocate(Size size, Byte value, Size alignment);
+
+		/**
+		 * @brief Reallocates a block of memory with the specified size and alignment from the memory pool.
+		 *
+		 * If the memory block is the top-most block of its end, it is resized in place when possible.
+		 *
+		 * @param[in] address   The address of the memory block to reallocate.
+		 * @param[in] size      The size of the memory block to reallocate in bytes.
+		 * @param[in] alignment The alignment requirement for the memory block. Must be a power of two.
+		 *
+		 * @returns VoidPtr storing the address the reallocated memory block, or nullptr if the memory pool is exhausted.
+		 */
+		VoidPtr Reallocate(VoidPtr address, Size size, Size alignment);
+
+	public:
+		/**
+		 * @brief Deallocates a block of memory with the specified address from the memory pool.
+		 *
+		 * Only the top-most block of either end is popped, other blocks are released by FreeToMarker or Reset.
+		 *
+		 * @param[in] address The address of the memory block to deallocate.
+		 */
+		Void Deallocate(VoidPtr address);
+
+		/**
+		 * @brief Gets the size of the memory block at the specified address.
+		 *
+		 * Only the top-most memory block of either end has a known size, which is always the one deallocated next.
+		 *
+		 * @param[in] address The address of the memory block.
+		 *
+		 * @return Size storing the size of the memory block in bytes, or zero if it is not the top-most memory block.
+		 */
+		Size GetAllocatedSize(VoidPtr address);
+
+		/**
+		 * @brief Checks whether the memory block at the specified address was allocated from the memory pool.
+		 *
+		 * @param[in] address The address of the memory block.
+		 *
+		 * @return True if the address lies within the memory pool, otherwise false.
+		 */
+		Bool Owns(VoidPtr address);
+
+	public:
+		/**
+		 * @brief Resets the entire memory pool by rewinding both ends of the stack.
+		 */
+		Void Reset();
+	};
+}
+
+#include "../Private/Policies/StackAllocationPolicy.inl"
+
+#endif
@@ -0,0 +1,212 @@
+#ifndef THREAD_ARENA_ALLOCATION_POLICY_HPP
+#define THREAD_ARENA_ALLOCATION_POLICY_HPP
+
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "IAllocationPolicy.hpp"
+#include "HeapAllocationPolicy.hpp"
+
+#include <forge-memory/BitUtilities.hpp>
+#include <forge-memory/SizeClassTable.hpp>
+
+namespace Forge {
+	/**
+	 * @brief This policy gives every thread a private arena it allocates from without
+	 * any synchronization.
+	 *
+	 * Every block records the arena that owns it. Deallocating a block on its owning
+	 * thread pushes it on a local free list, deallocating it on any other thread
+	 * pushes it on the owner's lock-free remote free queue. The owner reclaims its
+	 * remote free queue lazily, once a local free list runs dry. Arenas of exited
+	 * threads are adopted by new threads.
+	 *
+	 * Initialize, Deinitialize and Reset must not run concurrently with other calls.
+	 *
+	 * @tparam BackingPolicy The memory policy arena chunks and large requests are allocated from.
+	 * @tparam MaxSize The largest request served from the arenas in bytes.
+	 */
+	template<typename BackingPolicy = HeapAllocationPolicy, Size MaxSize = 32768>
+	class ThreadArenaAllocationPolicy final : public IAllocationPolicy<ThreadArenaAllocationPolicy<BackingPolicy, MaxSize>>
+	{
+	public:
+		static constexpr Size NUM_OF_SIZE_CLASSES = SizeClassTable<MaxSize>::GetNumOfSizeClasses();
+		static constexpr ::std::array<Size, NUM_OF_SIZE_CLASSES> SIZE_CLASSES = SizeClassTable<MaxSize>::GenerateSizeClasses();
+
+		static constexpr Size HEADER_SIZE = 16;
+		static constexpr Size CHUNK_SIZE = (MaxSize + HEADER_SIZE) * 8 < 1024 * 1024 ? 1024 * 1024 : NextPowerOfTwo((MaxSize + HEADER_SIZE) * 8);
+
+	private:
+		struct Arena;
+
+		struct BlockHeader
+		{
+			// Null for large blocks, which are owned by the central store instead.
+			Arena* m_owner;
+
+			// The size class index of a small block, or the offset from the large block for a large block.
+			Size m_class_index;
+		};
+
+		struct LargeBlock
+		{
+			LargeBlock* m_next;
+			LargeBlock* m_previous;
+			Size        m_size;
+		};
+
+		struct FreeBlock
+		{
+			FreeBlock* m_next;
+		};
+
+		struct Chunk
+		{
+			Chunk* m_next;
+		};
+
+		struct Arena
+		{
+			Arena* m_next;
+			Arena* m_next_abandoned;
+
+			FreeBlock* m_free_lists[NUM_OF_SIZE_CLASSES];
+			Byte*      m_current;
+			Byte*      m_end;
+
+			alignas(64) ::std::atomic<FreeBlock*> m_remote_free_list;
+		};
+
+		struct CentralStore
+		{
+			::std::mutex  m_mutex;
+			BackingPolicy m_backing_policy;
+			Chunk*        m_chunks;
+			LargeBlock*   m_large_blocks;
+			Arena*        m_arenas;
+			Arena*        m_abandoned_arenas;
+			Bool          m_is_alive;
+
+			~CentralStore();
+		};
+
+		struct ThreadArena
+		{
+			::std::shared_ptr<CentralStore> m_central_store;
+
+			Arena* m_arena;
+
+			~ThreadArena();
+		};
+
+		struct ThreadArenaRegistry
+		{
+			Size   m_last_id;
+			Arena* m_last_arena;
+
+			::std::vector<::std::pair<Size, ::std::unique_ptr<ThreadArena>>> m_arenas;
+		};
+
+	private:
+		static inline ::std::atomic<Size> s_next_id{ 1 };
+		static inline thread_local ThreadArenaRegistry s_registry{ 0, nullptr, {} };
+
+	private:
+		Size m_id;
+
+		::std::shared_ptr<CentralStore> m_central_store;
+
+	public:
+		ThreadArenaAllocationPolicy();
+
+	public:
+		/**
+		 * @brief Initializes a memory pool with the specified capacity using a defined memory policy.
+		 *
+		 * @param capacity The size of the memory pool to initialize in bytes, forwarded to the backing policy.
+		 */
+		Void Initialize(Size capacity);
+
+		/**
+		 * @brief Deinitializes the memory pool managed by the defined memory policy.
+		 */
+		Void Deinitialize();
+
+	public:
+		/**
+		 * @brief Allocates a block of memory with the specified size and alignment from the arena of the calling thread.
+		 *
+		 * @param[in] size      The size of the memory block to allocate in bytes.
+		 * @param[in] alignment The alignment requirement for the memory block. Must be a power of two.
+		 *
+		 * @return VoidPtr storing the address the allocated memory block, or nullptr if the memory pool is exhausted.
+		 */
+		VoidPtr Allocate(Size size, Size alignment);
+
+		/**
+		 * @brief Allocates a block of memory with the specified size and alignment from the arena of the calling thread.
+		 *
+		 * @param[in] size      The size of the memory block to allocate in bytes.
+		 * @param[in] value     The value to set each byte of the memory block to.
+		 * @param[in] alignment The alignment requirement for the memory block. Must be a power of two.
+		 *
+		 * @return VoidPtr storing the address the allocated memory block, or nullptr if the memory pool is exhausted.
+		 */
+		VoidPtr Callocate(Size size, Byte value, Size alignment);
+
+		/**
+		 * @brief Reallocates a block of memory with the specified size and alignment.
+		 *
+		 * The memory block is returned as is if the new size still fits its size class.
+		 *
+		 * @param[in] address   The address of the memory block to reallocate.
+		 * @param[in] size      The size of the memory block to reallocate in bytes.
+		 * @param[in] alignment The alignment requirement for the memory block. Must be a power of two.
+		 *
+		 * @returns VoidPtr storing the address the reallocated memory block, or nullptr if the memory pool is exhausted.
+		 */
+		VoidPtr Reallocate(VoidPtr address, Size size, Size alignment);
+
+	public:
+		/**
+		 * @brief Deallocates a block of memory, returning it to the arena that owns it.
+		 *
+		 * May be called from any thread, blocks owned by another thread are pushed on its remote free queue.
+		 *
+		 * @param[in] address The address of the memory block to deallocate.
+		 */
+		Void Deallocate(VoidPtr address);
+
+		/**
+		 * @brief Gets the usable size of the memory block at the specified address.
+		 *
+		 * @param[in] address The address of the memory block.
+		 *
+		 * @return Size storing the size of the size class or large block the address belongs to in bytes.
+		 */
+		Size GetAllocatedSize(VoidPtr address);
+
+	public:
+		/**
+		 * @brief Resets the entire memory pool, emptying the arena of every thread.
+		 */
+		Void Reset();
+
+	private:
+		Arena* GetThreadArena();
+
+		Void ReclaimRemoteFrees(Arena* arena);
+		Bool RefillArena(Arena* arena, Size stride);
+
+		VoidPtr AllocateLarge(Size size, Size alignment);
+		Void    DeallocateLarge(BlockHeader* header);
+
+		Void ReleaseCentralStore();
+	};
+}
+
+#include "../Private/Policies/ThreadArenaAllocationPolicy.inl"
+
+#endif
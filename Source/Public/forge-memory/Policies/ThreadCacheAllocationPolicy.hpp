@@ -0,0 +1,274 @@
+#ifndef THREAD_CACHE_ALLOCATION_POLICY_HPP
+#define THREAD_CACHE_ALLOCATION_POLICY_HPP
+
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "IAllocationPolicy.hpp"
+#include "HeapAllocationPolicy.hpp"
+
+#include <forge-memory/PageMap.hpp>
+#include <forge-memory/SizeClassTable.hpp>
+
+namespace Forge {
+	/**
+	 * @brief This policy puts a per-thread cache in front of a single-threaded backing policy.
+	 *
+	 * Every thread keeps a magazine of free blocks per size class. Allocations and
+	 * deallocations that hit the magazine take no locks and touch no shared cache
+	 * lines. Magazines are refilled from and flushed to a shared central store in
+	 * batches, which is the only place the backing policy is touched under a lock.
+	 *
+	 * Small blocks carry no header. Spans are page aligned and every page of a span
+	 * maps to its size class in a page map, which is how a block finds its size class
+	 * on deallocation.
+	 *
+	 * Initialize, Deinitialize and Reset must not run concurrently with other calls.
+	 *
+	 * @tparam BackingPolicy The memory policy spans and large requests are allocated from.
+	 * @tparam MaxSize The largest request served from the thread caches in bytes.
+	 */
+	template<typename BackingPolicy = HeapAllocationPolicy, Size MaxSize = 32768>
+	class ThreadCacheAllocationPolicy final : public IAllocationPolicy<ThreadCacheAllocationPolicy<BackingPolicy, MaxSize>>
+	{
+	public:
+		static constexpr Size NUM_OF_SIZE_CLASSES = SizeClassTable<MaxSize>::GetNumOfSizeClasses();
+		static constexpr ::std::array<Size, NUM_OF_SIZE_CLASSES> SIZE_CLASSES = SizeClassTable<MaxSize>::GenerateSizeClasses();
+
+		static constexpr Size HEADER_SIZE = 16;
+		static constexpr Size LARGE_CLASS = ~static_cast<Size>(0);
+
+		static constexpr Size PAGE_SHIFT = 13;
+		static constexpr Size PAGE_SIZE = static_cast<Size>(1) << PAGE_SHIFT;
+
+		static constexpr Size MAGAZINE_SIZE = 64 * 1024;
+		static constexpr Size MAX_MAGAZINE_COUNT = 256;
+		static constexpr Size MAX_THREAD_CACHE_SIZE = 2 * 1024 * 1024;
+
+	private:
+		// Only large blocks carry a header, pages of small block spans are looked up in the page map instead.
+		struct BlockHeader
+		{
+			Size m_class_index;
+			Size m_offset;
+		};
+
+		struct LargeBlock
+		{
+			LargeBlock* m_next;
+			LargeBlock* m_previous;
+			Size        m_size;
+		};
+
+		struct FreeBlock
+		{
+			FreeBlock* m_next;
+		};
+
+		struct CentralFreeList
+		{
+			::std::mutex m_mutex;
+			FreeBlock*   m_free_list;
+			Size         m_count;
+		};
+
+		struct CentralStore
+		{
+			::std::mutex    m_mutex;
+			BackingPolicy   m_backing_policy;
+			LargeBlock*     m_large_blocks;
+			Bool            m_is_alive;
+			CentralFreeList m_free_lists[NUM_OF_SIZE_CLASSES];
+
+			::std::atomic<Size> m_generation;
+
+			// Pages of small block spans map to their size class index plus one, any other page maps to zero.
+			PageMap<PAGE_SHIFT> m_page_map;
+
+			::std::vector<::std::pair<VoidPtr, Size>> m_spans;
+		};
+
+		struct Magazine
+		{
+			FreeBlock* m_free_list;
+			Size       m_count;
+		};
+
+		struct ThreadCache
+		{
+			::std::shared_ptr<CentralStore> m_central_store;
+
+			Size     m_generation;
+			Size     m_cached_size;
+			Magazine m_magazines[NUM_OF_SIZE_CLASSES];
+
+			~ThreadCache();
+		};
+
+		struct ThreadCacheRegistry
+		{
+			Size         m_last_id;
+			ThreadCache* m_last_cache;
+
+			::std::vector<::std::pair<Size, ::std::unique_ptr<ThreadCache>>> m_caches;
+		};
+
+	private:
+		static inline ::std::atomic<Size> s_next_id{ 1 };
+		static inline thread_local ThreadCacheRegistry s_registry{ 0, nullptr, {} };
+
+	private:
+		Size m_id;
+
+		::std::shared_ptr<CentralStore> m_central_store;
+
+	public:
+		ThreadCacheAllocationPolicy();
+
+	public:
+		/**
+		 * @brief Gets the number of bytes held in the magazines of the calling thread.
+		 *
+		 * @return Size storing the number of bytes cached by the calling thread.
+		 */
+		Size GetThreadCacheSize();
+
+		/**
+		 * @brief Returns every block cached by the calling thread to the central store.
+		 */
+		Void FlushThreadCache();
+
+	public:
+		/**
+		 * @brief Initializes a memory pool with the specified capacity using a defined memory policy.
+		 *
+		 * @param capacity The size of the memory pool to initialize in bytes, forwarded to the backing policy.
+		 */
+		Void Initialize(Size capacity);
+
+		/**
+		 * @brief Deinitializes the memory pool managed by the defined memory policy.
+		 */
+		Void Deinitialize();
+
+	public:
+		/**
+		 * @brief Allocates a block of memory with the specified size and alignment from the memory pool.
+		 *
+		 * @param[in] size      The size of the memory block to allocate in bytes.
+		 * @param[in] alignment The alignment requirement for the memory block. Must be a power of two.
+		 *
+		 * @return VoidPtr storing the address the allocated memory block, or nullptr if the memory pool is exhausted.
+		 */
+		VoidPtr Allocate(Size size, Size alignment);
+
+		/**
+		 * @brief Allocates a block of memory with the specified size and alignment from the memory pool.
+		 *
+		 * @param[in] size      The size of the memory block to allocate in bytes.
+		 * @param[in] value     The value to set each byte of the memory block to.
+		 * @param[in] alignment The alignment requirement for the memory block. Must be a power of two.
+		 *
+		 * @return VoidPtr storing the address the allocated memory block, or nullptr if the memory pool is exhausted.
+		 */
+		VoidPtr Callocate(Size size, Byte value, Size alignment);
+
+		/**
+		 * @brief Reallocates a block of memory with the specified size and alignment from the memory pool.
+		 *
+		 * The memory block is returned as is if the new size and alignment still map to its size class.
+		 *
+		 * @param[in] address   The address of the memory block to reallocate.
+		 * @param[in] size      The size of the memory block to reallocate in bytes.
+		 * @param[in] alignment The alignment requirement for the memory block. Must be a power of two.
+		 *
+		 * @returns VoidPtr storing the address the reallocated memory block, or nullptr if the memory pool is exhausted.
+		 */
+		VoidPtr Reallocate(VoidPtr address, Size size, Size alignment);
+
+		/**
+		 * @brief Allocates a block of memory of at least the specified size and reports the size of its size class.
+		 *
+		 * @param[in] size      The minimum size of the memory block to allocate in bytes.
+		 * @param[in] alignment The alignment requirement for the memory block. Must be a power of two.
+		 *
+		 * @return AllocationResult storing the address of the allocated memory block and its usable size.
+		 */
+		AllocationResult AllocateAtLeast(Size size, Size alignment);
+
+	public:
+		/**
+		 * @brief Deallocates a block of memory with the specified address from the memory pool.
+		 *
+		 * May be called from any thread, the block is cached by the calling thread.
+		 *
+		 * @param[in] address The address of the memory block to deallocate.
+		 */
+		Void Deallocate(VoidPtr address);
+
+		/**
+		 * @brief Deallocates a block of memory whose size and alignment are known to the caller from the memory pool.
+		 *
+		 * The size class follows from the size and alignment, so the page map is never looked up.
+		 *
+		 * @param[in] address   The address of the memory block to deallocate.
+		 * @param[in] size      The size the memory block was last allocated or reallocated with.
+		 * @param[in] alignment The alignment the memory block was last allocated or reallocated with.
+		 */
+		Void DeallocateSized(VoidPtr address, Size size, Size alignment);
+
+		/**
+		 * @brief Gets the usable size of the memory block at the specified address.
+		 *
+		 * Small blocks carry no header, their size class is looked up in the page map of their span.
+		 *
+		 * @param[in] address The address of the memory block.
+		 *
+		 * @return Size storing the size of the size class or large block the address belongs to in bytes.
+		 */
+		Size GetAllocatedSize(VoidPtr address);
+
+		/**
+		 * @brief Gets the usable size of a memory block from the size and alignment it was allocated with.
+		 *
+		 * The size class follows from the size and alignment, and large blocks are exactly as large as requested,
+		 * so the page map is never looked up.
+		 *
+		 * @param[in] address   The address of the memory block.
+		 * @param[in] size      The size the memory block was last allocated or reallocated with.
+		 * @param[in] alignment The alignment the memory block was last allocated or reallocated with.
+		 *
+		 * @return Size storing the size of the size class or large block the memory block belongs to in bytes.
+		 */
+		Size GetRoundedSize(VoidPtr address, Size size, Size alignment);
+
+	public:
+		/**
+		 * @brief Resets the entire memory pool, invalidating the caches of every thread.
+		 */
+		Void Reset();
+
+	private:
+		static Size GetClassIndex(Size size, Size alignment);
+		static Size GetMagazineCapacity(Size class_index);
+		static Size GetBatchSize(Size class_index);
+
+		static Void FlushMagazine(ThreadCache* thread_cache, Size class_index, Size count);
+
+		ThreadCache* GetThreadCache();
+
+		Bool RefillMagazine(ThreadCache* thread_cache, Size class_index);
+		Void DeallocateSmall(VoidPtr address, Size class_index);
+
+		VoidPtr AllocateLarge(Size size, Size alignment);
+		Void    DeallocateLarge(BlockHeader* header);
+
+		Void ReleaseCentralStore();
+	};
+}
+
+#include "../Private/Policies/ThreadCacheAllocationPolicy.inl"
+
+#endif
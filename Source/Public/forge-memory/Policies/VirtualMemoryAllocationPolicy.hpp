@@ -0,0 +1,162 @@
+#ifndef VIRTUAL_MEMORY_ALLOCATION_POLICY_HPP
+#define VIRTUAL_MEMORY_ALLOCATION_POLICY_HPP
+
+#include "IAllocationPolicy.hpp"
+
+#include <forge-memory/VirtualMemory.hpp>
+
+namespace Forge {
+	/**
+	 * @brief This policy serves allocations by bumping a pointer forward through a
+	 * reserved range of address space.
+	 *
+	 * Initialize only reserves the address range, pages are committed on demand as
+	 * the bump pointer advances and decommitted again on reset. The capacity can
+	 * therefore be sized for the worst case without paying for it in physical memory,
+	 * and memory blocks never move as the memory pool grows.
+	 *
+	 * The address range can optionally be backed by huge pages, which cuts TLB misses
+	 * when walking large arenas at the cost of committing memory in huge page steps.
+	 */
+	class VirtualMemoryAllocationPolicy final : public IAllocationPolicy<VirtualMemoryAllocationPolicy>
+	{
+	public:
+		static constexpr Size COMMIT_GRANULARITY = 64 * 1024;
+
+	private:
+		Byte* m_start;
+		Size  m_offset;
+		Size  m_committed;
+		Size  m_capacity;
+
+	private:
+		PageBacking m_page_backing;
+		Size        m_commit_granularity;
+		Bool        m_is_huge_page_backed;
+
+	private:
+		VoidPtr m_last_address;
+
+	public:
+		VirtualMemoryAllocationPolicy(PageBacking page_backing = PageBacking::Normal);
+
+	public:
+		/**
+		 * @brief Initializes a memory pool with the specified capacity using a defined memory policy.
+		 *
+		 * @param capacity The size of the address range to reserve in bytes, rounded up to the page size.
+		 */
+		Void Initialize(Size capacity);
+
+		/**
+		 * @brief Deinitializes the memory pool managed by the defined memory policy.
+		 */
+		Void Deinitialize();
+
+	public:
+		/**
+		 * @brief Allocates a block of memory with the specified size and alignment from the memory pool.
+		 *
+		 * @param[in] size      The size of the memory block to allocate in bytes.
+		 * @param[in] alignment The alignment requirement for the memory block. Must be a power of two.
+		 *
+		 * @return VoidPtr storing the address the allocated memory block, or nullptr if the memory pool is exhausted.
+		 */
+		VoidPtr Allocate(Size size, Size alignment);
+
+		/**
+		 * @brief Allocates a block of memory with the specified size and alignment from the memory pool.
+		 *
+		 * @param[in] size      The size of the memory block to allocate in bytes.
+		 * @param[in] value     The value to set each byte of the memory block to.
+		 * @param[in] alignment The alignment requirement for the memory block. Must be a power of two.
+		 *
+		 * @return VoidPtr storing the address the allocated memory block, or nullptr if the memory pool is exhausted.
+		 */
+		VoidPtr Callocate(Size size, Byte value, Size alignment);
+
+		/**
+		 * @brief Reallocates a block of memory with the specified size and alignment from the memory pool.
+		 *
+		 * If the memory block is the most recent allocation, it is resized in place.
+		 *
+		 * @param[in] address   The address of the memory block to reallocate.
+		 * @param[in] size      The size of the memory block to reallocate in bytes.
+		 * @param[in] alignment The alignment requirement for the memory block. Must be a power of two.
+		 *
+		 * @returns VoidPtr storing the address the reallocated memory block, or nullptr if the memory pool is exhausted.
+		 */
+		VoidPtr Reallocate(VoidPtr address, Size size, Size alignment);
+
+	public:
+		/**
+		 * @brief Does nothing, memory blocks are only released on reset.
+		 *
+		 * @param[in] address The address of the memory block to deallocate.
+		 */
+		Void Deallocate(VoidPtr address);
+
+		/**
+		 * @brief Gets the size of the memory block at the specified address.
+		 *
+		 * Only the last allocated memory block has a known size, which is the one reallocated in place.
+		 *
+		 * @param[in] address The address of the memory block.
+		 *
+		 * @return Size storing the size of the memory block in bytes, or zero if it is not the last allocated memory block.
+		 */
+		Size GetAllocatedSize(VoidPtr address);
+
+		/**
+		 * @brief Checks whether the memory block at the specified address was allocated from the memory pool.
+		 *
+		 * @param[in] address The address of the memory block.
+		 *
+		 * @return True if the address lies within the memory pool, otherwise false.
+		 */
+		Bool Owns(VoidPtr address);
+
+	public:
+		/**
+		 * @brief Resets the entire memory pool by rewinding the bump pointer and decommitting every committed page.
+		 */
+		Void Reset();
+
+	public:
+		/**
+		 * @brief Sets the kind of pages the memory pool is backed by. Takes effect on the next call to Initialize.
+		 *
+		 * @param[in] page_backing The kind of pages to back the memory pool by.
+		 */
+		Void SetPageBacking(PageBacking page_backing);
+
+		/**
+		 * @brief Gets the kind of pages requested for the memory pool.
+		 *
+		 * @returns PageBacking storing the kind of pages requested for the memory pool.
+		 */
+		PageBacking GetPageBacking() const;
+
+		/**
+		 * @brief Checks whether the memory pool actually got backed by huge pages, or fell back to normal pages.
+		 *
+		 * @returns True if the memory pool is backed by huge pages, otherwise false.
+		 */
+		Bool IsHugePageBacked() const;
+
+	public:
+		/**
+		 * @brief Gets the number of bytes of the memory pool currently committed.
+		 *
+		 * @returns Size storing the number of committed bytes.
+		 */
+		Size GetCommittedSize() const;
+
+	private:
+		Bool Commit(Size offset);
+	};
+}
+
+#include "../Private/Policies/VirtualMemoryAllocationPolicy.inl"
+
+#endif
@@ -0,0 +1,50 @@
+#ifndef SIZE_CLASS_TABLE_HPP
+#define SIZE_CLASS_TABLE_HPP
+
+#include <array>
+
+#include <forge-base/Core/Types.hpp>
+#include <forge-base/Core/System.hpp>
+
+namespace Forge {
+	/**
+	 * @brief This class generates a compile-time table of size classes.
+	 *
+	 * Size classes are spaced 16 bytes apart up to 128 bytes and four per power of
+	 * two above that, which bounds internal fragmentation to 25%.
+	 *
+	 * @tparam MaxSize The largest size class in bytes.
+	 */
+	template<Size MaxSize>
+	struct SizeClassTable
+	{
+		static_assert(MaxSize >= 128, "The maximum size class must be at least 128 bytes");
+
+		/**
+		 * @brief Gets the number of size classes up to MaxSize.
+		 *
+		 * @return Size storing the number of size classes.
+		 */
+		static constexpr Size GetNumOfSizeClasses();
+
+		/**
+		 * @brief Generates the table of size classes in ascending order.
+		 *
+		 * @return std::array storing the size of every size class in bytes.
+		 */
+		static constexpr auto GenerateSizeClasses();
+
+		/**
+		 * @brief Gets the index of the smallest size class the specified size fits in.
+		 *
+		 * @param[in] size The size to look up in bytes. Must not exceed MaxSize.
+		 *
+		 * @return Size storing the index of the size class.
+		 */
+		static Size GetSizeClassIndex(Size size);
+	};
+}
+
+#include "../Private/SizeClassTable.inl"
+
+#endif
@@ -0,0 +1,154 @@
+#ifndef CONCURRENT_STATS_HPP
+#define CONCURRENT_STATS_HPP
+
+#include <atomic>
+
+#include <forge-base/Core/Types.hpp>
+#include <forge-base/Core/System.hpp>
+
+namespace Forge {
+	/**
+	 * @brief This statistics policy keeps counters of the allocations made through
+	 * the allocator that are safe to update from any number of threads.
+	 *
+	 * Counters are sharded per thread, each shard on its own cache line, so threads
+	 * updating their counters never contend. Getters aggregate every shard on read.
+	 * The peak size is sampled, it is only refreshed every PEAK_SAMPLE_INTERVAL
+	 * allocations of a thread and on every read, so short spikes may be missed.
+	 */
+	class ConcurrentStats
+	{
+	public:
+		static constexpr Bool IS_ENABLED = true;
+		static constexpr Bool IS_TIMED = false;
+
+		static constexpr Size NUM_OF_SHARDS = 64;
+		static constexpr Size PEAK_SAMPLE_INTERVAL = 256;
+
+	private:
+		struct alignas(64) Shard
+		{
+			// Blocks may be freed on another thread than they were allocated on, so only the sum over all shards is meaningful.
+			::std::atomic<Size> m_total_size;
+			::std::atomic<Size> m_num_of_allocations;
+			::std::atomic<Size> m_num_of_deallocations;
+		};
+
+	private:
+		static inline ::std::atomic<Size> s_next_shard_index{ 0 };
+		static inline thread_local Size s_shard_index = s_next_shard_index.fetch_add(1, ::std::memory_order_relaxed) % NUM_OF_SHARDS;
+
+	private:
+		Shard m_shards[NUM_OF_SHARDS];
+
+		alignas(64) mutable ::std::atomic<Size> m_peak_size;
+
+	public:
+		ConcurrentStats();
+
+	public:
+		/**
+		 * @brief Records an allocation.
+		 *
+		 * @param[in] address        The address of the allocated memory block.
+		 * @param[in] size           The requested size of the memory block in bytes.
+		 * @param[in] alignment      The requested alignment of the memory block.
+		 * @param[in] allocated_size The size accounted for the memory block in bytes.
+		 */
+		Void OnAllocate(VoidPtr address, Size size, Size alignment, Size allocated_size);
+
+		/**
+		 * @brief Records a filled allocation, which counts as an allocation.
+		 *
+		 * @param[in] address        The address of the allocated memory block.
+		 * @param[in] size           The requested size of the memory block in bytes.
+		 * @param[in] value          The value each byte of the memory block was set to.
+		 * @param[in] alignment      The requested alignment of the memory block.
+		 * @param[in] allocated_size The size accounted for the memory block in bytes.
+		 */
+		Void OnCallocate(VoidPtr address, Size size, Byte value, Size alignment, Size allocated_size);
+
+		/**
+		 * @brief Records a reallocation, which counts as an allocation.
+		 *
+		 * @param[in] old_address        The address of the memory block before the reallocation.
+		 * @param[in] new_address        The address of the memory block after the reallocation.
+		 * @param[in] size               The requested size of the memory block in bytes.
+		 * @param[in] alignment          The requested alignment of the memory block.
+		 * @param[in] old_allocated_size The size accounted for the memory block before the reallocation in bytes.
+		 * @param[in] allocated_size     The size accounted for the memory block after the reallocation in bytes.
+		 */
+		Void OnReallocate(VoidPtr old_address, VoidPtr new_address, Size size, Size alignment, Size old_allocated_size, Size allocated_size);
+
+		/**
+		 * @brief Records a batch of allocations with the same size and alignment, which count as one allocation each.
+		 *
+		 * @param[in] addresses      The addresses of the allocated memory blocks.
+		 * @param[in] count          The number of allocated memory blocks.
+		 * @param[in] size           The requested size of each memory block in bytes.
+		 * @param[in] alignment      The requested alignment of each memory block.
+		 * @param[in] allocated_size The size accounted for all memory blocks together in bytes.
+		 */
+		Void OnAllocateBatch(const VoidPtr* addresses, Size count, Size size, Size alignment, Size allocated_size);
+
+		/**
+		 * @brief Records a deallocation.
+		 *
+		 * @param[in] address        The address of the deallocated memory block.
+		 * @param[in] allocated_size The size accounted for the memory block in bytes.
+		 */
+		Void OnDeallocate(VoidPtr address, Size allocated_size);
+
+		/**
+		 * @brief Records a batch of deallocations, which count as one deallocation each.
+		 *
+		 * @param[in] addresses      The addresses of the deallocated memory blocks.
+		 * @param[in] count          The number of deallocated memory blocks.
+		 * @param[in] allocated_size The size accounted for all memory blocks together in bytes.
+		 */
+		Void OnDeallocateBatch(const VoidPtr* addresses, Size count, Size allocated_size);
+
+		/**
+		 * @brief Resets every counter to zero. Must not run concurrently with other calls.
+		 */
+		Void Reset();
+
+	public:
+		/**
+		 * @brief Gets the peak size allocated during lifetime of the allocator.
+		 *
+		 * @return Size storing the highest total size sampled for the allocator in bytes.
+		 */
+		Size GetPeakSize() const;
+
+		/**
+		 * @brief Gets the total size of the memory blocks currently allocated by the allocator.
+		 *
+		 * @return Size storing the total size allocated by the allocator in bytes.
+		 */
+		Size GetTotalSize() const;
+
+		/**
+		 * @brief Gets the number of allocations during lifetime of the allocator.
+		 *
+		 * @return Size storing the number of allocations by the allocator.
+		 */
+		Size GetNumOfAllocations() const;
+
+		/**
+		 * @brief Gets the number of deallocations during lifetime of the allocator.
+		 *
+		 * @return Size storing the number of deallocations by the allocator.
+		 */
+		Size GetNumOfDeallocations() const;
+
+	private:
+		Shard& GetShard();
+
+		Void SamplePeakSize() const;
+	};
+}
+
+#include "../Private/Stats/ConcurrentStats.inl"
+
+#endif
@@ -0,0 +1,223 @@
+#ifndef HISTOGRAM_STATS_HPP
+#define HISTOGRAM_STATS_HPP
+
+#include <string>
+
+#include "SimpleStats.hpp"
+
+#include <forge-base/Core/Types.hpp>
+#include <forge-base/Core/System.hpp>
+
+namespace Forge {
+	/**
+	 * @brief A copy of every counter and histogram of a HistogramStats at one point in time.
+	 *
+	 * Bucket i of a histogram counts the values in [2^i, 2^(i+1)), bucket zero also counts zero.
+	 */
+	struct HistogramSnapshot
+	{
+		static constexpr Size NUM_OF_BUCKETS = 64;
+
+		Size m_peak_size;
+		Size m_total_size;
+		Size m_num_of_allocations;
+		Size m_num_of_deallocations;
+
+		Size m_size_histogram[NUM_OF_BUCKETS];
+		Size m_alignment_histogram[NUM_OF_BUCKETS];
+
+		// Only filled in if the latency was recorded, otherwise every bucket is zero.
+		Bool m_is_latency_recorded;
+		Size m_allocate_latency_histogram[NUM_OF_BUCKETS];
+		Size m_reallocate_latency_histogram[NUM_OF_BUCKETS];
+		Size m_deallocate_latency_histogram[NUM_OF_BUCKETS];
+
+		/**
+		 * @brief Serializes the snapshot to a JSON object.
+		 *
+		 * Histograms are written as arrays of their non-empty buckets, each with its lower bound and count.
+		 *
+		 * @return ::std::string storing the JSON object.
+		 */
+		::std::string ToJson() const;
+
+		/**
+		 * @brief Serializes the histograms of the snapshot to CSV.
+		 *
+		 * Writes one row per non-empty bucket with the columns histogram, lower_bound, upper_bound and count.
+		 *
+		 * @return ::std::string storing the CSV table including its header row.
+		 */
+		::std::string ToCsv() const;
+	};
+
+	/**
+	 * @brief This statistics policy keeps log2 bucketed histograms of the requested
+	 * size and alignment of every allocation made through the allocator, on top of
+	 * the counters kept by SimpleStats.
+	 *
+	 * If RecordLatency is true the allocator also times every Allocate, Reallocate
+	 * and Deallocate with ReadCycleCounter and the latencies are kept in histograms
+	 * as well. Timing adds two counter reads to every call, so it is off by default.
+	 *
+	 * The histograms are not synchronized, use one allocator per thread or guard the
+	 * allocator if it is shared between threads.
+	 *
+	 * @tparam RecordLatency Whether to record the latency of every call in cycles.
+	 */
+	template<Bool RecordLatency = false>
+	class HistogramStats
+	{
+	public:
+		static constexpr Bool IS_ENABLED = true;
+		static constexpr Bool IS_TIMED = RecordLatency;
+
+		static constexpr Size NUM_OF_BUCKETS = HistogramSnapshot::NUM_OF_BUCKETS;
+
+	private:
+		SimpleStats m_counters;
+
+		Size m_size_histogram[NUM_OF_BUCKETS];
+		Size m_alignment_histogram[NUM_OF_BUCKETS];
+
+		Size m_allocate_latency_histogram[NUM_OF_BUCKETS];
+		Size m_reallocate_latency_histogram[NUM_OF_BUCKETS];
+		Size m_deallocate_latency_histogram[NUM_OF_BUCKETS];
+
+	public:
+		HistogramStats();
+
+	public:
+		/**
+		 * @brief Records an allocation.
+		 *
+		 * @param[in] address        The address of the allocated memory block.
+		 * @param[in] size           The requested size of the memory block in bytes.
+		 * @param[in] alignment      The requested alignment of the memory block.
+		 * @param[in] allocated_size The size accounted for the memory block in bytes.
+		 */
+		Void OnAllocate(VoidPtr address, Size size, Size alignment, Size allocated_size);
+
+		/**
+		 * @brief Records a filled allocation, which counts as an allocation.
+		 *
+		 * @param[in] address        The address of the allocated memory block.
+		 * @param[in] size           The requested size of the memory block in bytes.
+		 * @param[in] value          The value each byte of the memory block was set to.
+		 * @param[in] alignment      The requested alignment of the memory block.
+		 * @param[in] allocated_size The size accounted for the memory block in bytes.
+		 */
+		Void OnCallocate(VoidPtr address, Size size, Byte value, Size alignment, Size allocated_size);
+
+		/**
+		 * @brief Records a reallocation, which counts as an allocation.
+		 *
+		 * @param[in] old_address        The address of the memory block before the reallocation.
+		 * @param[in] new_address        The address of the memory block after the reallocation.
+		 * @param[in] size               The requested size of the memory block in bytes.
+		 * @param[in] alignment          The requested alignment of the memory block.
+		 * @param[in] old_allocated_size The size accounted for the memory block before the reallocation in bytes.
+		 * @param[in] allocated_size     The size accounted for the memory block after the reallocation in bytes.
+		 */
+		Void OnReallocate(VoidPtr old_address, VoidPtr new_address, Size size, Size alignment, Size old_allocated_size, Size allocated_size);
+
+		/**
+		 * @brief Records a batch of allocations with the same size and alignment, which count as one allocation each.
+		 *
+		 * @param[in] addresses      The addresses of the allocated memory blocks.
+		 * @param[in] count          The number of allocated memory blocks.
+		 * @param[in] size           The requested size of each memory block in bytes.
+		 * @param[in] alignment      The requested alignment of each memory block.
+		 * @param[in] allocated_size The size accounted for all memory blocks together in bytes.
+		 */
+		Void OnAllocateBatch(const VoidPtr* addresses, Size count, Size size, Size alignment, Size allocated_size);
+
+		/**
+		 * @brief Records a deallocation.
+		 *
+		 * @param[in] address        The address of the deallocated memory block.
+		 * @param[in] allocated_size The size accounted for the memory block in bytes.
+		 */
+		Void OnDeallocate(VoidPtr address, Size allocated_size);
+
+		/**
+		 * @brief Records a batch of deallocations, which count as one deallocation each.
+		 *
+		 * @param[in] addresses      The addresses of the deallocated memory blocks.
+		 * @param[in] count          The number of deallocated memory blocks.
+		 * @param[in] allocated_size The size accounted for all memory blocks together in bytes.
+		 */
+		Void OnDeallocateBatch(const VoidPtr* addresses, Size count, Size allocated_size);
+
+		/**
+		 * @brief Resets every counter and histogram to zero.
+		 */
+		Void Reset();
+
+	public:
+		/**
+		 * @brief Records the latency of an Allocate or Callocate call.
+		 *
+		 * @param[in] cycles The number of cycles the call took.
+		 */
+		Void OnAllocateLatency(Size cycles);
+
+		/**
+		 * @brief Records the latency of a Reallocate call.
+		 *
+		 * @param[in] cycles The number of cycles the call took.
+		 */
+		Void OnReallocateLatency(Size cycles);
+
+		/**
+		 * @brief Records the latency of a Deallocate call.
+		 *
+		 * @param[in] cycles The number of cycles the call took.
+		 */
+		Void OnDeallocateLatency(Size cycles);
+
+	public:
+		/**
+		 * @brief Gets the peak size allocated during lifetime of the allocator.
+		 *
+		 * @return Size storing the highest total size reached by the allocator in bytes.
+		 */
+		Size GetPeakSize() const;
+
+		/**
+		 * @brief Gets the total size of the memory blocks currently allocated by the allocator.
+		 *
+		 * @return Size storing the total size allocated by the allocator in bytes.
+		 */
+		Size GetTotalSize() const;
+
+		/**
+		 * @brief Gets the number of allocations during lifetime of the allocator.
+		 *
+		 * @return Size storing the number of allocations by the allocator.
+		 */
+		Size GetNumOfAllocations() const;
+
+		/**
+		 * @brief Gets the number of deallocations during lifetime of the allocator.
+		 *
+		 * @return Size storing the number of deallocations by the allocator.
+		 */
+		Size GetNumOfDeallocations() const;
+
+	public:
+		/**
+		 * @brief Copies every counter and histogram.
+		 *
+		 * @return HistogramSnapshot storing the counters and histograms at the time of the call.
+		 */
+		HistogramSnapshot Snapshot() const;
+
+	private:
+		static Size GetBucketIndex(Size value);
+	};
+}
+
+#include "../Private/Stats/HistogramStats.inl"
+
+#endif
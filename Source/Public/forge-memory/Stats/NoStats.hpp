@@ -0,0 +1,120 @@
+#ifndef NO_STATS_HPP
+#define NO_STATS_HPP
+
+#include <forge-base/Core/Types.hpp>
+#include <forge-base/Core/System.hpp>
+
+namespace Forge {
+	/**
+	 * @brief This statistics policy records nothing.
+	 *
+	 * The allocator skips every statistics hook at compile time, so no code is left
+	 * on the hot path. Every getter returns zero.
+	 */
+	class NoStats
+	{
+	public:
+		static constexpr Bool IS_ENABLED = false;
+		static constexpr Bool IS_TIMED = false;
+
+	public:
+		/**
+		 * @brief Does nothing, no allocations are recorded.
+		 *
+		 * @param[in] address        The address of the allocated memory block.
+		 * @param[in] size           The requested size of the memory block in bytes.
+		 * @param[in] alignment      The requested alignment of the memory block.
+		 * @param[in] allocated_size The size accounted for the memory block in bytes.
+		 */
+		Void OnAllocate(VoidPtr address, Size size, Size alignment, Size allocated_size);
+
+		/**
+		 * @brief Does nothing, no allocations are recorded.
+		 *
+		 * @param[in] address        The address of the allocated memory block.
+		 * @param[in] size           The requested size of the memory block in bytes.
+		 * @param[in] value          The value each byte of the memory block was set to.
+		 * @param[in] alignment      The requested alignment of the memory block.
+		 * @param[in] allocated_size The size accounted for the memory block in bytes.
+		 */
+		Void OnCallocate(VoidPtr address, Size size, Byte value, Size alignment, Size allocated_size);
+
+		/**
+		 * @brief Does nothing, no reallocations are recorded.
+		 *
+		 * @param[in] old_address        The address of the memory block before the reallocation.
+		 * @param[in] new_address        The address of the memory block after the reallocation.
+		 * @param[in] size               The requested size of the memory block in bytes.
+		 * @param[in] alignment          The requested alignment of the memory block.
+		 * @param[in] old_allocated_size The size accounted for the memory block before the reallocation in bytes.
+		 * @param[in] allocated_size     The size accounted for the memory block after the reallocation in bytes.
+		 */
+		Void OnReallocate(VoidPtr old_address, VoidPtr new_address, Size size, Size alignment, Size old_allocated_size, Size allocated_size);
+
+		/**
+		 * @brief Does nothing, no allocations are recorded.
+		 *
+		 * @param[in] addresses      The addresses of the allocated memory blocks.
+		 * @param[in] count          The number of allocated memory blocks.
+		 * @param[in] size           The requested size of each memory block in bytes.
+		 * @param[in] alignment      The requested alignment of each memory block.
+		 * @param[in] allocated_size The size accounted for all memory blocks together in bytes.
+		 */
+		Void OnAllocateBatch(const VoidPtr* addresses, Size count, Size size, Size alignment, Size allocated_size);
+
+		/**
+		 * @brief Does nothing, no deallocations are recorded.
+		 *
+		 * @param[in] address        The address of the deallocated memory block.
+		 * @param[in] allocated_size The size accounted for the memory block in bytes.
+		 */
+		Void OnDeallocate(VoidPtr address, Size allocated_size);
+
+		/**
+		 * @brief Does nothing, no deallocations are recorded.
+		 *
+		 * @param[in] addresses      The addresses of the deallocated memory blocks.
+		 * @param[in] count          The number of deallocated memory blocks.
+		 * @param[in] allocated_size The size accounted for all memory blocks together in bytes.
+		 */
+		Void OnDeallocateBatch(const VoidPtr* addresses, Size count, Size allocated_size);
+
+		/**
+		 * @brief Does nothing, there is nothing to reset.
+		 */
+		Void Reset();
+
+	public:
+		/**
+		 * @brief Gets the peak size allocated during lifetime of the allocator.
+		 *
+		 * @return Size storing zero.
+		 */
+		Size GetPeakSize() const;
+
+		/**
+		 * @brief Gets the total size of the memory blocks currently allocated by the allocator.
+		 *
+		 * @return Size storing zero.
+		 */
+		Size GetTotalSize() const;
+
+		/**
+		 * @brief Gets the number of allocations during lifetime of the allocator.
+		 *
+		 * @return Size storing zero.
+		 */
+		Size GetNumOfAllocations() const;
+
+		/**
+		 * @brief Gets the number of deallocations during lifetime of the allocator.
+		 *
+		 * @return Size storing zero.
+		 */
+		Size GetNumOfDeallocations() const;
+	};
+}
+
+#include "../Private/Stats/NoStats.inl"
+
+#endif
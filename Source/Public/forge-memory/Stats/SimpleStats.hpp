@@ -0,0 +1,130 @@
+#ifndef SIMPLE_STATS_HPP
+#define SIMPLE_STATS_HPP
+
+#include <forge-base/Core/Types.hpp>
+#include <forge-base/Core/System.hpp>
+
+namespace Forge {
+	/**
+	 * @brief This statistics policy keeps plain counters of the allocations made
+	 * through the allocator.
+	 *
+	 * The counters are not synchronized, use ConcurrentStats if the allocator is
+	 * shared between threads.
+	 */
+	class SimpleStats
+	{
+	public:
+		static constexpr Bool IS_ENABLED = true;
+		static constexpr Bool IS_TIMED = false;
+
+	private:
+		Size m_peak_size;
+		Size m_total_size;
+		Size m_num_of_allocations;
+		Size m_num_of_deallocations;
+
+	public:
+		SimpleStats();
+
+	public:
+		/**
+		 * @brief Records an allocation.
+		 *
+		 * @param[in] address        The address of the allocated memory block.
+		 * @param[in] size           The requested size of the memory block in bytes.
+		 * @param[in] alignment      The requested alignment of the memory block.
+		 * @param[in] allocated_size The size accounted for the memory block in bytes.
+		 */
+		Void OnAllocate(VoidPtr address, Size size, Size alignment, Size allocated_size);
+
+		/**
+		 * @brief Records a filled allocation, which counts as an allocation.
+		 *
+		 * @param[in] address        The address of the allocated memory block.
+		 * @param[in] size           The requested size of the memory block in bytes.
+		 * @param[in] value          The value each byte of the memory block was set to.
+		 * @param[in] alignment      The requested alignment of the memory block.
+		 * @param[in] allocated_size The size accounted for the memory block in bytes.
+		 */
+		Void OnCallocate(VoidPtr address, Size size, Byte value, Size alignment, Size allocated_size);
+
+		/**
+		 * @brief Records a reallocation, which counts as an allocation.
+		 *
+		 * @param[in] old_address        The address of the memory block before the reallocation.
+		 * @param[in] new_address        The address of the memory block after the reallocation.
+		 * @param[in] size               The requested size of the memory block in bytes.
+		 * @param[in] alignment          The requested alignment of the memory block.
+		 * @param[in] old_allocated_size The size accounted for the memory block before the reallocation in bytes.
+		 * @param[in] allocated_size     The size accounted for the memory block after the reallocation in bytes.
+		 */
+		Void OnReallocate(VoidPtr old_address, VoidPtr new_address, Size size, Size alignment, Size old_allocated_size, Size allocated_size);
+
+		/**
+		 * @brief Records a batch of allocations with the same size and alignment, which count as one allocation each.
+		 *
+		 * @param[in] addresses      The addresses of the allocated memory blocks.
+		 * @param[in] count          The number of allocated memory blocks.
+		 * @param[in] size           The requested size of each memory block in bytes.
+		 * @param[in] alignment      The requested alignment of each memory block.
+		 * @param[in] allocated_size The size accounted for all memory blocks together in bytes.
+		 */
+		Void OnAllocateBatch(const VoidPtr* addresses, Size count, Size size, Size alignment, Size allocated_size);
+
+		/**
+		 * @brief Records a deallocation.
+		 *
+		 * @param[in] address        The address of the deallocated memory block.
+		 * @param[in] allocated_size The size accounted for the memory block in bytes.
+		 */
+		Void OnDeallocate(VoidPtr address, Size allocated_size);
+
+		/**
+		 * @brief Records a batch of deallocations, which count as one deallocation each.
+		 *
+		 * @param[in] addresses      The addresses of the deallocated memory blocks.
+		 * @param[in] count          The number of deallocated memory blocks.
+		 * @param[in] allocated_size The size accounted for all memory blocks together in bytes.
+		 */
+		Void OnDeallocateBatch(const VoidPtr* addresses, Size count, Size allocated_size);
+
+		/**
+		 * @brief Resets every counter to zero.
+		 */
+		Void Reset();
+
+	public:
+		/**
+		 * @brief Gets the peak size allocated during lifetime of the allocator.
+		 *
+		 * @return Size storing the highest total size reached by the allocator in bytes.
+		 */
+		Size GetPeakSize() const;
+
+		/**
+		 * @brief Gets the total size of the memory blocks currently allocated by the allocator.
+		 *
+		 * @return Size storing the total size allocated by the allocator in bytes.
+		 */
+		Size GetTotalSize() const;
+
+		/**
+		 * @brief Gets the number of allocations during lifetime of the allocator.
+		 *
+		 * @return Size storing the number of allocations by the allocator.
+		 */
+		Size GetNumOfAllocations() const;
+
+		/**
+		 * @brief Gets the number of deallocations during lifetime of the allocator.
+		 *
+		 * @return Size storing the number of deallocations by the allocator.
+		 */
+		Size GetNumOfDeallocations() const;
+	};
+}
+
+#include "../Private/Stats/SimpleStats.inl"
+
+#endif
@@ -0,0 +1,212 @@
+#ifndef TRACE_STATS_HPP
+#define TRACE_STATS_HPP
+
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <cstdio>
+
+#include "ConcurrentStats.hpp"
+
+#include <forge-memory/Trace.hpp>
+
+#include <forge-base/Core/Types.hpp>
+#include <forge-base/Core/System.hpp>
+
+namespace Forge {
+	/**
+	 * @brief This statistics policy records a binary trace of every call made
+	 * through the allocator, on top of the counters kept by ConcurrentStats.
+	 *
+	 * Every thread writes its records to its own ring buffer without any
+	 * synchronization. A ring buffer is written to the trace file once it fills
+	 * up and whenever Flush is called, which is the only time a lock is taken.
+	 * Records are only written while a trace file is open.
+	 *
+	 * Open and Close must not run concurrently with other calls.
+	 */
+	class TraceStats
+	{
+	public:
+		static constexpr Bool IS_ENABLED = true;
+		static constexpr Bool IS_TIMED = false;
+
+		static constexpr Size BUFFER_CAPACITY = 4096;
+
+	private:
+		struct ThreadBuffer
+		{
+			// Only written by the owning thread.
+			alignas(64) ::std::atomic<Size> m_head;
+
+			// Only written while holding the lock of the trace file.
+			alignas(64) ::std::atomic<Size> m_tail;
+
+			::std::uint32_t m_thread_id;
+
+			TraceRecord m_records[BUFFER_CAPACITY];
+		};
+
+		struct ThreadBufferRegistry
+		{
+			Size          m_last_id;
+			ThreadBuffer* m_last_buffer;
+
+			::std::vector<::std::pair<Size, ThreadBuffer*>> m_buffers;
+		};
+
+	private:
+		static inline ::std::atomic<Size> s_next_id{ 1 };
+		static inline thread_local ThreadBufferRegistry s_registry{ 0, nullptr, {} };
+
+	private:
+		Size m_id;
+
+		ConcurrentStats m_counters;
+
+		::std::mutex m_mutex;
+		FILE*        m_file;
+
+		::std::atomic<Bool> m_is_recording;
+
+		::std::vector<::std::unique_ptr<ThreadBuffer>> m_buffers;
+
+	public:
+		TraceStats();
+		~TraceStats();
+
+	public:
+		/**
+		 * @brief Opens a trace file and starts recording.
+		 *
+		 * @param[in] path The path of the trace file to create, an existing file is overwritten.
+		 *
+		 * @return True if the trace file was created, otherwise false.
+		 */
+		Bool Open(const char* path);
+
+		/**
+		 * @brief Writes every buffered record and closes the trace file.
+		 */
+		Void Close();
+
+		/**
+		 * @brief Writes the buffered records of every thread to the trace file.
+		 */
+		Void Flush();
+
+		/**
+		 * @brief Checks whether a trace file is open.
+		 *
+		 * @return True if calls are being recorded, otherwise false.
+		 */
+		Bool IsRecording() const;
+
+	public:
+		/**
+		 * @brief Records an allocation.
+		 *
+		 * @param[in] address        The address of the allocated memory block.
+		 * @param[in] size           The requested size of the memory block in bytes.
+		 * @param[in] alignment      The requested alignment of the memory block.
+		 * @param[in] allocated_size The size accounted for the memory block in bytes.
+		 */
+		Void OnAllocate(VoidPtr address, Size size, Size alignment, Size allocated_size);
+
+		/**
+		 * @brief Records a filled allocation.
+		 *
+		 * @param[in] address        The address of the allocated memory block.
+		 * @param[in] size           The requested size of the memory block in bytes.
+		 * @param[in] value          The value each byte of the memory block was set to.
+		 * @param[in] alignment      The requested alignment of the memory block.
+		 * @param[in] allocated_size The size accounted for the memory block in bytes.
+		 */
+		Void OnCallocate(VoidPtr address, Size size, Byte value, Size alignment, Size allocated_size);
+
+		/**
+		 * @brief Records a reallocation.
+		 *
+		 * @param[in] old_address        The address of the memory block before the reallocation.
+		 * @param[in] new_address        The address of the memory block after the reallocation.
+		 * @param[in] size               The requested size of the memory block in bytes.
+		 * @param[in] alignment          The requested alignment of the memory block.
+		 * @param[in] old_allocated_size The size accounted for the memory block before the reallocation in bytes.
+		 * @param[in] allocated_size     The size accounted for the memory block after the reallocation in bytes.
+		 */
+		Void OnReallocate(VoidPtr old_address, VoidPtr new_address, Size size, Size alignment, Size old_allocated_size, Size allocated_size);
+
+		/**
+		 * @brief Records a batch of allocations with the same size and alignment as one trace record per memory block.
+		 *
+		 * @param[in] addresses      The addresses of the allocated memory blocks.
+		 * @param[in] count          The number of allocated memory blocks.
+		 * @param[in] size           The requested size of each memory block in bytes.
+		 * @param[in] alignment      The requested alignment of each memory block.
+		 * @param[in] allocated_size The size accounted for all memory blocks together in bytes.
+		 */
+		Void OnAllocateBatch(const VoidPtr* addresses, Size count, Size size, Size alignment, Size allocated_size);
+
+		/**
+		 * @brief Records a deallocation.
+		 *
+		 * @param[in] address        The address of the deallocated memory block.
+		 * @param[in] allocated_size The size accounted for the memory block in bytes.
+		 */
+		Void OnDeallocate(VoidPtr address, Size allocated_size);
+
+		/**
+		 * @brief Records a batch of deallocations as one trace record per memory block.
+		 *
+		 * @param[in] addresses      The addresses of the deallocated memory blocks.
+		 * @param[in] count          The number of deallocated memory blocks.
+		 * @param[in] allocated_size The size accounted for all memory blocks together in bytes.
+		 */
+		Void OnDeallocateBatch(const VoidPtr* addresses, Size count, Size allocated_size);
+
+		/**
+		 * @brief Records a reset of the memory pool and resets every counter to zero.
+		 */
+		Void Reset();
+
+	public:
+		/**
+		 * @brief Gets the peak size allocated during lifetime of the allocator.
+		 *
+		 * @return Size storing the sampled highest total size reached by the allocator in bytes.
+		 */
+		Size GetPeakSize() const;
+
+		/**
+		 * @brief Gets the total size of the memory blocks currently allocated by the allocator.
+		 *
+		 * @return Size storing the total size allocated by the allocator in bytes.
+		 */
+		Size GetTotalSize() const;
+
+		/**
+		 * @brief Gets the number of allocations during lifetime of the allocator.
+		 *
+		 * @return Size storing the number of allocations by the allocator.
+		 */
+		Size GetNumOfAllocations() const;
+
+		/**
+		 * @brief Gets the number of deallocations during lifetime of the allocator.
+		 *
+		 * @return Size storing the number of deallocations by the allocator.
+		 */
+		Size GetNumOfDeallocations() const;
+
+	private:
+		ThreadBuffer* GetThreadBuffer();
+
+		Void Record(TraceOperation operation, VoidPtr address, VoidPtr old_address, Size size, Size alignment, Byte value);
+		Void Drain(ThreadBuffer* buffer);
+	};
+}
+
+#include "../Private/Stats/TraceStats.inl"
+
+#endif
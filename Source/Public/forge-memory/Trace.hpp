@@ -0,0 +1,78 @@
+#ifndef TRACE_HPP
+#define TRACE_HPP
+
+#include <vector>
+#include <cstdint>
+
+#include <forge-base/Core/Types.hpp>
+#include <forge-base/Core/System.hpp>
+
+namespace Forge {
+	/**
+	 * @brief The allocator call a trace record was written for.
+	 */
+	enum class TraceOperation : Byte
+	{
+		Allocate,
+		Callocate,
+		Reallocate,
+		Deallocate,
+		Reset
+	};
+
+	/**
+	 * @brief A single allocator call as written to a trace file.
+	 *
+	 * Addresses are only used as ids, a replay maps them to the memory blocks it allocated itself.
+	 * Records of different threads are interleaved in the file, sort them by timestamp to restore
+	 * the order the calls were made in.
+	 */
+	struct TraceRecord
+	{
+		Size m_timestamp;
+
+		// The address of the memory block, or of the new memory block for a reallocation.
+		Size m_address;
+
+		// The address of the memory block before a reallocation, zero for every other operation.
+		Size m_old_address;
+
+		Size m_size;
+
+		::std::uint32_t m_thread_id;
+
+		TraceOperation m_operation;
+		Byte           m_alignment_log2;
+		Byte           m_value;
+		Byte           m_reserved;
+	};
+
+	/**
+	 * @brief The header written once at the start of every trace file.
+	 */
+	struct TraceFileHeader
+	{
+		Byte            m_magic[8];
+		::std::uint32_t m_version;
+		::std::uint32_t m_record_size;
+	};
+
+	static constexpr Byte TRACE_MAGIC[8] = { 'F', 'M', 'T', 'R', 'A', 'C', 'E', '\0' };
+	static constexpr ::std::uint32_t TRACE_VERSION = 1;
+
+	static_assert(sizeof(TraceRecord) == 40, "TraceRecord is part of the trace file format");
+
+	/**
+	 * @brief Reads every record of a trace file in the order they were written.
+	 *
+	 * @param[in]  path    The path of the trace file.
+	 * @param[out] records The records read from the trace file.
+	 *
+	 * @return True if the trace file was read, false if it could not be opened or is not a trace file of this version.
+	 */
+	Bool ReadTrace(const char* path, ::std::vector<TraceRecord>& records);
+}
+
+#include "../Private/Trace.inl"
+
+#endif
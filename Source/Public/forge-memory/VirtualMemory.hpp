@@ -0,0 +1,120 @@
+#ifndef VIRTUAL_MEMORY_HPP
+#define VIRTUAL_MEMORY_HPP
+
+#include <forge-base/Core/Types.hpp>
+#include <forge-base/Core/System.hpp>
+
+namespace Forge {
+	/**
+	 * @brief Specifies the kind of pages a reserved address range is backed by.
+	 */
+	enum class PageBacking
+	{
+		// Regular pages of the operating system page size.
+		Normal,
+
+		// Huge page aligned address range the kernel is advised to back with transparent huge pages.
+		TransparentHuge,
+
+		// Huge pages taken from the explicitly configured huge page pool.
+		ExplicitHuge
+	};
+
+	/**
+	 * @brief Queries the page size of the operating system.
+	 *
+	 * @returns Size storing the page size in bytes, which is the granularity of every virtual memory operation.
+	 */
+	Size VirtualGetPageSize();
+
+	/**
+	 * @brief Reserves a range of address space without backing it by physical memory.
+	 *
+	 * @param[in] size The size of the address range to reserve in bytes. Must be a multiple of the page size.
+	 *
+	 * @returns VoidPtr storing the start of the reserved address range, or nullptr if the reservation failed.
+	 */
+	VoidPtr VirtualReserve(Size size);
+
+	/**
+	 * @brief Queries the huge page size of the operating system.
+	 *
+	 * @returns Size storing the huge page size in bytes, or zero if huge pages are not supported.
+	 */
+	Size VirtualGetHugePageSize();
+
+	/**
+	 * @brief Reserves a range of address space backed by the specified kind of pages.
+	 *
+	 * Falls back to transparent huge pages if explicit huge pages are not available,
+	 * and to normal pages if transparent huge pages are not available either.
+	 *
+	 * @param[in]  size                The size of the address range to reserve in bytes. Must be a multiple of the huge page size unless normal pages are requested.
+	 * @param[in]  page_backing        The kind of pages to back the address range by.
+	 * @param[out] is_huge_page_backed Set to true if the address range ended up backed by huge pages, otherwise false.
+	 *
+	 * @returns VoidPtr storing the start of the reserved address range, or nullptr if the reservation failed.
+	 */
+	VoidPtr VirtualReserve(Size size, PageBacking page_backing, Bool& is_huge_page_backed);
+
+	/**
+	 * @brief Commits pages of a reserved address range, making them readable and writable.
+	 *
+	 * Physical memory is only charged once a committed page is first touched.
+	 *
+	 * @param[in] address The start of the pages to commit. Must be page aligned.
+	 * @param[in] size    The size of the pages to commit in bytes. Must be a multiple of the page size.
+	 *
+	 * @returns True if the pages were committed, otherwise false.
+	 */
+	Bool VirtualCommit(VoidPtr address, Size size);
+
+	/**
+	 * @brief Decommits pages of a reserved address range, returning their physical memory to the operating system.
+	 *
+	 * The address range stays reserved, the pages must be committed again before they are accessed.
+	 *
+	 * @param[in] address The start of the pages to decommit. Must be page aligned.
+	 * @param[in] size    The size of the pages to decommit in bytes. Must be a multiple of the page size.
+	 */
+	Void VirtualDecommit(VoidPtr address, Size size);
+
+	/**
+	 * @brief Releases a reserved address range along with any committed pages within it.
+	 *
+	 * @param[in] address The start of the address range, as returned by VirtualReserve.
+	 * @param[in] size    The size of the address range in bytes, as passed to VirtualReserve.
+	 */
+	Void VirtualRelease(VoidPtr address, Size size);
+
+	/**
+	 * @brief Queries the number of NUMA nodes of the system.
+	 *
+	 * @returns Size storing the number of NUMA nodes, which is one on systems without NUMA support.
+	 */
+	Size VirtualGetNumOfNodes();
+
+	/**
+	 * @brief Queries the NUMA node of the processor the calling thread currently runs on.
+	 *
+	 * @returns Size storing the index of the current NUMA node.
+	 */
+	Size VirtualGetCurrentNode();
+
+	/**
+	 * @brief Sets the preferred NUMA node physical memory of the specified pages is taken from.
+	 *
+	 * Only pages first touched after the call are affected.
+	 *
+	 * @param[in] address The start of the pages to bind. Must be page aligned.
+	 * @param[in] size    The size of the pages to bind in bytes.
+	 * @param[in] node    The index of the NUMA node to bind the pages to. Must be less than 64.
+	 *
+	 * @returns True if the pages were bound, otherwise false.
+	 */
+	Bool VirtualBindToNode(VoidPtr address, Size size, Size node);
+}
+
+#include "../Private/VirtualMemory.inl"
+
+#endif
@@ -0,0 +1,567 @@
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <unordered_map>
+#include <vector>
+
+#include <forge-memory/Allocator.hpp>
+#include <forge-memory/ForgeStdAllocator.hpp>
+#include <forge-memory/MemoryStreaming.hpp>
+#include <forge-memory/MemoryUtilities.hpp>
+
+#include <forge-memory/Policies/HeapAllocationPolicy.hpp>
+#include <forge-memory/Policies/LinearAllocationPolicy.hpp>
+#include <forge-memory/Policies/StackAllocationPolicy.hpp>
+#include <forge-memory/Policies/PoolAllocationPolicy.hpp>
+#include <forge-memory/Policies/ConcurrentPoolAllocationPolicy.hpp>
+#include <forge-memory/Policies/FreeListAllocationPolicy.hpp>
+#include <forge-memory/Policies/BuddyAllocationPolicy.hpp>
+#include <forge-memory/Policies/SizeClassAllocationPolicy.hpp>
+#include <forge-memory/Policies/ThreadCacheAllocationPolicy.hpp>
+#include <forge-memory/Policies/ThreadArenaAllocationPolicy.hpp>
+#include <forge-memory/Policies/VirtualMemoryAllocationPolicy.hpp>
+#include <forge-memory/Policies/NumaAllocationPolicy.hpp>
+
+using namespace Forge;
+
+namespace
+{
+	constexpr Size NUM_OF_ROUNDS = 5;
+	constexpr Size NUM_OF_OPERATIONS = 100000;
+	constexpr Size WORKING_SET_SIZE = 1024;
+	constexpr Size NUM_OF_GROWTH_CHAINS = 100;
+	constexpr Size MAX_GROWTH_SIZE = 1024 * 1024;
+	constexpr Size ARRAY_LENGTH = 16;
+	constexpr Size ALIGNMENT = 16;
+	constexpr Size CAPACITY = static_cast<Size>(512) * 1024 * 1024;
+
+	// Pools only serve a single block size, so every request of the other benchmarks has to fit it.
+	constexpr Size POOL_BLOCK_SIZE = 4096;
+	constexpr Size MIN_RANDOM_SIZE = 16;
+	constexpr Size MAX_RANDOM_SIZE = POOL_BLOCK_SIZE;
+
+	struct BenchObject
+	{
+		Size m_values[4];
+
+		BenchObject() : m_values{ 1, 2, 3, 4 } {}
+		~BenchObject() { m_values[0] = 0; }
+	};
+
+	struct BenchInput
+	{
+		::std::vector<Size> m_sizes;
+		::std::vector<Size> m_slots;
+	};
+
+	class MallocBackend
+	{
+	public:
+		template<typename InType>
+		using StdAllocator = ::std::allocator<InType>;
+
+	public:
+		Void Initialize(Size capacity) {}
+		Void Deinitialize() {}
+
+		VoidPtr Allocate(Size size, Size alignment) { return malloc(size); }
+		VoidPtr Reallocate(VoidPtr address, Size size, Size alignment) { return realloc(address, size); }
+		Void    Deallocate(VoidPtr address) { free(address); }
+
+		Size AllocateBatch(Size size, Size alignment, Size count, VoidPtr* addresses)
+		{
+			for (Size index = 0; index < count; index++) {
+				addresses[index] = malloc(size);
+
+				if (!addresses[index]) {
+					return index;
+				}
+			}
+
+			return count;
+		}
+		Void DeallocateBatch(VoidPtr* addresses, Size count)
+		{
+			for (Size index = 0; index < count; index++) {
+				free(addresses[index]);
+			}
+		}
+
+		BenchObject* ConstructArray(Size count) { return new BenchObject[count]; }
+		Void         DestructArray(BenchObject* address, Size count) { delete[] address; }
+
+		template<typename InType>
+		StdAllocator<InType> GetStdAllocator() { return StdAllocator<InType>(); }
+
+		Void Reset() {}
+	};
+
+	template<typename AllocationPolicy>
+	class ForgeBackend
+	{
+	private:
+		Allocator<AllocationPolicy, NoStats> m_allocator;
+
+	public:
+		template<typename InType>
+		using StdAllocator = ForgeStdAllocator<InType, AllocationPolicy, NoStats>;
+
+	public:
+		Void Initialize(Size capacity) { m_allocator.Initialize(capacity); }
+		Void Deinitialize() { m_allocator.Deinitialize(); }
+
+		VoidPtr Allocate(Size size, Size alignment) { return m_allocator.Allocate(size, alignment); }
+		VoidPtr Reallocate(VoidPtr address, Size size, Size alignment) { return m_allocator.Reallocate(address, size, alignment); }
+		Void    Deallocate(VoidPtr address) { m_allocator.Deallocate(address); }
+
+		Size AllocateBatch(Size size, Size alignment, Size count, VoidPtr* addresses) { return m_allocator.AllocateBatch(size, alignment, count, addresses); }
+		Void DeallocateBatch(VoidPtr* addresses, Size count) { m_allocator.DeallocateBatch(addresses, count); }
+
+		BenchObject* ConstructArray(Size count) { return m_allocator.template ConstructArray<BenchObject>(count); }
+		Void         DestructArray(BenchObject* address, Size count) { m_allocator.DestructArray(address, count); }
+
+		template<typename InType>
+		StdAllocator<InType> GetStdAllocator() { return StdAllocator<InType>(m_allocator); }
+
+		Void Reset() { m_allocator.Reset(); }
+	};
+
+	Size NextRandom(Size& state)
+	{
+		state ^= state << 13;
+		state ^= state >> 7;
+		state ^= state << 17;
+
+		return state;
+	}
+
+	BenchInput GenerateInput()
+	{
+		BenchInput input;
+		input.m_sizes.resize(NUM_OF_OPERATIONS);
+		input.m_slots.resize(NUM_OF_OPERATIONS);
+
+		Size state = 0x9E3779B97F4A7C15ull;
+
+		for (Size index = 0; index < NUM_OF_OPERATIONS; index++) {
+			// Small sizes dominate real traffic, so pick a random power of two first and a random size below it.
+			Size limit = MIN_RANDOM_SIZE << (NextRandom(state) % 9);
+			Size size = NextRandom(state) % limit + 1;
+
+			input.m_sizes[index] = size < MIN_RANDOM_SIZE ? MIN_RANDOM_SIZE : size > MAX_RANDOM_SIZE ? MAX_RANDOM_SIZE : size;
+			input.m_slots[index] = NextRandom(state) % WORKING_SET_SIZE;
+		}
+
+		return input;
+	}
+
+	Void Touch(VoidPtr address)
+	{
+		*reinterpret_cast<Byte*>(address) = 1;
+	}
+
+	template<typename Backend>
+	Size BenchAllocateFree(Backend& backend, const BenchInput& input, Size& num_of_operations)
+	{
+		Size num_of_failures = 0;
+
+		for (Size index = 0; index < NUM_OF_OPERATIONS; index++) {
+			VoidPtr address = backend.Allocate(64, ALIGNMENT);
+
+			if (!address) {
+				num_of_failures++;
+				continue;
+			}
+
+			Touch(address);
+			backend.Deallocate(address);
+		}
+
+		num_of_operations = NUM_OF_OPERATIONS;
+
+		return num_of_failures;
+	}
+
+	template<typename Backend, Bool IsBatched>
+	Size BenchAllocateFreeMany(Backend& backend, const BenchInput& input, Size& num_of_operations)
+	{
+		Size num_of_failures = 0;
+
+		VoidPtr blocks[WORKING_SET_SIZE];
+
+		for (Size batch = 0; batch < NUM_OF_OPERATIONS / WORKING_SET_SIZE; batch++) {
+			Size num_of_blocks = 0;
+
+			if constexpr (IsBatched) {
+				num_of_blocks = backend.AllocateBatch(64, ALIGNMENT, WORKING_SET_SIZE, blocks);
+			}
+			else {
+				while (num_of_blocks < WORKING_SET_SIZE && (blocks[num_of_blocks] = backend.Allocate(64, ALIGNMENT))) {
+					num_of_blocks++;
+				}
+			}
+
+			num_of_failures += WORKING_SET_SIZE - num_of_blocks;
+
+			for (Size index = 0; index < num_of_blocks; index++) {
+				Touch(blocks[index]);
+			}
+
+			if constexpr (IsBatched) {
+				backend.DeallocateBatch(blocks, num_of_blocks);
+			}
+			else {
+				for (Size index = 0; index < num_of_blocks; index++) {
+					backend.Deallocate(blocks[index]);
+				}
+			}
+		}
+
+		num_of_operations = NUM_OF_OPERATIONS / WORKING_SET_SIZE * WORKING_SET_SIZE;
+
+		return num_of_failures;
+	}
+
+	template<typename Backend>
+	Size BenchChurn(Backend& backend, const BenchInput& input, Size& num_of_operations)
+	{
+		Size num_of_failures = 0;
+
+		VoidPtr slots[WORKING_SET_SIZE] = {};
+
+		for (Size index = 0; index < NUM_OF_OPERATIONS; index++) {
+			VoidPtr& slot = slots[input.m_slots[index]];
+
+			backend.Deallocate(slot);
+			slot = backend.Allocate(input.m_sizes[index], ALIGNMENT);
+
+			if (!slot) {
+				num_of_failures++;
+				continue;
+			}
+
+			Touch(slot);
+		}
+
+		for (VoidPtr slot : slots) {
+			backend.Deallocate(slot);
+		}
+
+		num_of_operations = NUM_OF_OPERATIONS;
+
+		return num_of_failures;
+	}
+
+	template<typename Backend, Bool IsLifo>
+	Size BenchLifetime(Backend& backend, const BenchInput& input, Size& num_of_operations)
+	{
+		Size num_of_failures = 0;
+
+		VoidPtr blocks[WORKING_SET_SIZE];
+
+		for (Size batch = 0; batch < NUM_OF_OPERATIONS / WORKING_SET_SIZE; batch++) {
+			for (Size index = 0; index < WORKING_SET_SIZE; index++) {
+				blocks[index] = backend.Allocate(input.m_sizes[batch * WORKING_SET_SIZE + index], ALIGNMENT);
+
+				if (!blocks[index]) {
+					num_of_failures++;
+					continue;
+				}
+
+				Touch(blocks[index]);
+			}
+
+			for (Size index = 0; index < WORKING_SET_SIZE; index++) {
+				backend.Deallocate(blocks[IsLifo ? WORKING_SET_SIZE - index - 1 : index]);
+			}
+		}
+
+		num_of_operations = NUM_OF_OPERATIONS / WORKING_SET_SIZE * WORKING_SET_SIZE;
+
+		return num_of_failures;
+	}
+
+	template<typename Backend>
+	Size BenchReallocateGrowth(Backend& backend, const BenchInput& input, Size& num_of_operations)
+	{
+		Size num_of_failures = 0;
+
+		num_of_operations = 0;
+
+		for (Size chain = 0; chain < NUM_OF_GROWTH_CHAINS; chain++) {
+			VoidPtr address = nullptr;
+
+			for (Size size = 16; size <= MAX_GROWTH_SIZE; size += size / 2) {
+				VoidPtr new_address = backend.Reallocate(address, size, ALIGNMENT);
+
+				num_of_operations++;
+
+				if (!new_address) {
+					num_of_failures++;
+					break;
+				}
+
+				address = new_address;
+				Touch(reinterpret_cast<Byte*>(address) + size - 1);
+			}
+
+			backend.Deallocate(address);
+		}
+
+		return num_of_failures;
+	}
+
+	template<typename Backend>
+	Size BenchConstructArray(Backend& backend, const BenchInput& input, Size& num_of_operations)
+	{
+		Size num_of_failures = 0;
+
+		for (Size index = 0; index < NUM_OF_OPERATIONS; index++) {
+			BenchObject* objects = backend.ConstructArray(ARRAY_LENGTH);
+
+			if (!objects) {
+				num_of_failures++;
+				continue;
+			}
+
+			backend.DestructArray(objects, ARRAY_LENGTH);
+		}
+
+		num_of_operations = NUM_OF_OPERATIONS;
+
+		return num_of_failures;
+	}
+
+	template<typename Backend>
+	Size BenchUnorderedMap(Backend& backend, const BenchInput& input, Size& num_of_operations)
+	{
+		using Map = ::std::unordered_map<Size, Size, ::std::hash<Size>, ::std::equal_to<Size>,
+			typename Backend::template StdAllocator<::std::pair<const Size, Size>>>;
+
+		num_of_operations = NUM_OF_OPERATIONS;
+
+		// Pools cannot serve the bucket array once it outgrows their block size.
+		try {
+			Map map(backend.template GetStdAllocator<::std::pair<const Size, Size>>());
+
+			for (Size index = 0; index < NUM_OF_OPERATIONS; index++) {
+				map[index * WORKING_SET_SIZE + input.m_slots[index]] = input.m_sizes[index];
+			}
+
+			for (Size index = 0; index < NUM_OF_OPERATIONS; index += 2) {
+				map.erase(index * WORKING_SET_SIZE + input.m_slots[index]);
+			}
+		}
+		catch (const ::std::bad_alloc&) {
+			return 1;
+		}
+
+		return 0;
+	}
+
+	Bool IsSelected(const char* name, const char* filter)
+	{
+		return !filter || strstr(name, filter);
+	}
+
+	template<typename Backend, typename Benchmark>
+	Void RunBenchmark(const char* benchmark_name, const char* policy_name, const BenchInput& input, Benchmark benchmark)
+	{
+		auto backend = ::std::make_unique<Backend>();
+		backend->Initialize(CAPACITY);
+
+		Float64 best_seconds = 0.0;
+		Size num_of_operations = 0;
+		Size num_of_failures = 0;
+
+		for (Size round = 0; round < NUM_OF_ROUNDS; round++) {
+			auto start = ::std::chrono::steady_clock::now();
+
+			num_of_failures += benchmark(*backend, input, num_of_operations);
+
+			Float64 seconds = ::std::chrono::duration<Float64>(::std::chrono::steady_clock::now() - start).count();
+
+			if (round == 0 || seconds < best_seconds) {
+				best_seconds = seconds;
+			}
+
+			// Linear and stack policies only give memory back on reset.
+			backend->Reset();
+		}
+
+		backend->Deinitialize();
+
+		if (num_of_failures) {
+			printf("%-20s %-16s %12s\n", benchmark_name, policy_name, "unsupported");
+		}
+		else {
+			printf("%-20s %-16s %12.2f Mops/s %10.1f ns/op\n", benchmark_name, policy_name,
+				num_of_operations / best_seconds / 1e6, best_seconds * 1e9 / num_of_operations);
+		}
+	}
+
+	template<typename Backend>
+	Void RunPolicy(const char* policy_name, const BenchInput& input, const char* benchmark_filter, const char* policy_filter)
+	{
+		if (!IsSelected(policy_name, policy_filter)) {
+			return;
+		}
+
+		if (IsSelected("allocate_free", benchmark_filter)) {
+			RunBenchmark<Backend>("allocate_free", policy_name, input, BenchAllocateFree<Backend>);
+		}
+		if (IsSelected("allocate_free_many", benchmark_filter)) {
+			RunBenchmark<Backend>("allocate_free_many", policy_name, input, BenchAllocateFreeMany<Backend, false>);
+		}
+		if (IsSelected("allocate_free_batch", benchmark_filter)) {
+			RunBenchmark<Backend>("allocate_free_batch", policy_name, input, BenchAllocateFreeMany<Backend, true>);
+		}
+		if (IsSelected("churn", benchmark_filter)) {
+			RunBenchmark<Backend>("churn", policy_name, input, BenchChurn<Backend>);
+		}
+		if (IsSelected("lifo", benchmark_filter)) {
+			RunBenchmark<Backend>("lifo", policy_name, input, BenchLifetime<Backend, true>);
+		}
+		if (IsSelected("fifo", benchmark_filter)) {
+			RunBenchmark<Backend>("fifo", policy_name, input, BenchLifetime<Backend, false>);
+		}
+		if (IsSelected("reallocate_growth", benchmark_filter)) {
+			RunBenchmark<Backend>("reallocate_growth", policy_name, input, BenchReallocateGrowth<Backend>);
+		}
+		if (IsSelected("construct_array", benchmark_filter)) {
+			RunBenchmark<Backend>("construct_array", policy_name, input, BenchConstructArray<Backend>);
+		}
+		if (IsSelected("unordered_map", benchmark_filter)) {
+			RunBenchmark<Backend>("unordered_map", policy_name, input, BenchUnorderedMap<Backend>);
+		}
+	}
+
+	template<typename Kernel>
+	Void RunMemoryBenchmark(const char* benchmark_name, const char* kernel_name, Size size, Kernel kernel)
+	{
+		Byte* destination = reinterpret_cast<Byte*>(malloc(size));
+		Byte* source = reinterpret_cast<Byte*>(malloc(size));
+
+		// Both blocks start equal, so the comparisons run over the whole block.
+		memset(destination, 1, size);
+		memset(source, 1, size);
+
+		// Moves about 1 GiB per round, so small sizes are not dominated by timer resolution.
+		Size num_of_iterations = (static_cast<Size>(1) << 30) / size;
+
+		Float64 best_seconds = 0.0;
+
+		for (Size round = 0; round < NUM_OF_ROUNDS; round++) {
+			auto start = ::std::chrono::steady_clock::now();
+
+			for (Size iteration = 0; iteration < num_of_iterations; iteration++) {
+				kernel(destination, source, size);
+
+				// Keeps the compiler from hoisting inlined fixed size kernels out of the loop.
+				::std::atomic_signal_fence(::std::memory_order_seq_cst);
+			}
+
+			Float64 seconds = ::std::chrono::duration<Float64>(::std::chrono::steady_clock::now() - start).count();
+
+			if (round == 0 || seconds < best_seconds) {
+				best_seconds = seconds;
+			}
+		}
+
+		// Keeps the compiler from dropping the copies.
+		volatile Byte sink = destination[size - 1];
+		(Void)sink;
+
+		printf("%-22s %-20s %10zu B %10.2f GB/s\n", benchmark_name, kernel_name, size,
+			static_cast<Float64>(size) * num_of_iterations / best_seconds / 1e9);
+
+		free(destination);
+		free(source);
+	}
+
+	// Keeps the compiler from dropping the comparisons.
+	volatile Bool g_compare_sink = false;
+
+	template<Size InSize>
+	Void RunFixedMemoryBenchmark(const char* benchmark_filter)
+	{
+		if (IsSelected("memory_copy_fixed", benchmark_filter)) {
+			RunMemoryBenchmark("memory_copy_fixed", "memcpy", InSize, [](Byte* destination, Byte* source, Size size) { memcpy(destination, source, size); });
+			RunMemoryBenchmark("memory_copy_fixed", "MemoryCopy<N>", InSize, [](Byte* destination, Byte* source, Size) { MemoryCopy<InSize>(destination, source); });
+		}
+		if (IsSelected("memory_compare_fixed", benchmark_filter)) {
+			RunMemoryBenchmark("memory_compare_fixed", "memcmp", InSize, [](Byte* destination, Byte* source, Size size) { g_compare_sink = memcmp(destination, source, size) == 0; });
+			RunMemoryBenchmark("memory_compare_fixed", "MemoryCompare<N>", InSize, [](Byte* destination, Byte* source, Size) { g_compare_sink = MemoryCompare<InSize>(destination, source); });
+		}
+	}
+
+	Void RunMemoryBenchmarks(const char* benchmark_filter)
+	{
+		const Size sizes[] = { 16, 48, 64, 256, 4096, 65536, 1024 * 1024, 16 * 1024 * 1024, 64 * 1024 * 1024 };
+
+		for (Size size : sizes) {
+			if (IsSelected("memory_copy", benchmark_filter)) {
+				RunMemoryBenchmark("memory_copy", "memcpy", size, [](Byte* destination, Byte* source, Size size) { memcpy(destination, source, size); });
+				RunMemoryBenchmark("memory_copy", "MemoryCopy", size, [](Byte* destination, Byte* source, Size size) { MemoryCopy(destination, source, size); });
+			}
+			if (IsSelected("memory_set", benchmark_filter)) {
+				RunMemoryBenchmark("memory_set", "memset", size, [](Byte* destination, Byte* source, Size size) { memset(destination, source[0], size); });
+				RunMemoryBenchmark("memory_set", "MemorySet", size, [](Byte* destination, Byte* source, Size size) { MemorySet(destination, source[0], size); });
+			}
+			if (IsSelected("memory_compare", benchmark_filter)) {
+				RunMemoryBenchmark("memory_compare", "memcmp", size, [](Byte* destination, Byte* source, Size size) { g_compare_sink = memcmp(destination, source, size) == 0; });
+				RunMemoryBenchmark("memory_compare", "MemoryCompare", size, [](Byte* destination, Byte* source, Size size) { g_compare_sink = MemoryCompare(destination, source, size); });
+			}
+			if (IsSelected("memory_copy_streaming", benchmark_filter) && size >= GetStreamingSettings().m_streaming_threshold) {
+				RunMemoryBenchmark("memory_copy_streaming", "memcpy", size, [](Byte* destination, Byte* source, Size size) { memcpy(destination, source, size); });
+				RunMemoryBenchmark("memory_copy_streaming", "MemoryCopyStreaming", size, [](Byte* destination, Byte* source, Size size) { MemoryCopyStreaming(destination, source, size); });
+			}
+			if (IsSelected("memory_set_streaming", benchmark_filter) && size >= GetStreamingSettings().m_streaming_threshold) {
+				RunMemoryBenchmark("memory_set_streaming", "memset", size, [](Byte* destination, Byte* source, Size size) { memset(destination, source[0], size); });
+				RunMemoryBenchmark("memory_set_streaming", "MemorySetStreaming", size, [](Byte* destination, Byte* source, Size size) { MemorySetStreaming(destination, source[0], size); });
+			}
+		}
+
+		RunFixedMemoryBenchmark<16>(benchmark_filter);
+		RunFixedMemoryBenchmark<32>(benchmark_filter);
+		RunFixedMemoryBenchmark<64>(benchmark_filter);
+		RunFixedMemoryBenchmark<256>(benchmark_filter);
+	}
+}
+
+int main(int argc, char** argv)
+{
+	if (argc > 1 && (strcmp(argv[1], "-h") == 0 || strcmp(argv[1], "--help") == 0)) {
+		printf("usage: forge_memory_bench [benchmark filter] [policy filter]\n");
+		printf("benchmarks: allocate_free, allocate_free_many, allocate_free_batch, churn, lifo, fifo, reallocate_growth, construct_array, unordered_map, memory_copy, memory_set, memory_compare, memory_copy_fixed, memory_compare_fixed, memory_copy_streaming, memory_set_streaming\n");
+		printf("policies: malloc, heap, linear, stack, pool, concurrentpool, freelist, buddy, sizeclass, threadcache, threadarena, virtualmemory, numa\n");
+		return EXIT_SUCCESS;
+	}
+
+	const char* benchmark_filter = argc > 1 ? argv[1] : nullptr;
+	const char* policy_filter = argc > 2 ? argv[2] : nullptr;
+
+	BenchInput input = GenerateInput();
+
+	RunPolicy<MallocBackend>("malloc", input, benchmark_filter, policy_filter);
+	RunPolicy<ForgeBackend<HeapAllocationPolicy>>("heap", input, benchmark_filter, policy_filter);
+	RunPolicy<ForgeBackend<LinearAllocationPolicy>>("linear", input, benchmark_filter, policy_filter);
+	RunPolicy<ForgeBackend<StackAllocationPolicy>>("stack", input, benchmark_filter, policy_filter);
+	RunPolicy<ForgeBackend<PoolAllocationPolicy<POOL_BLOCK_SIZE>>>("pool", input, benchmark_filter, policy_filter);
+	RunPolicy<ForgeBackend<ConcurrentPoolAllocationPolicy<POOL_BLOCK_SIZE>>>("concurrentpool", input, benchmark_filter, policy_filter);
+	RunPolicy<ForgeBackend<FreeListAllocationPolicy>>("freelist", input, benchmark_filter, policy_filter);
+	RunPolicy<ForgeBackend<BuddyAllocationPolicy>>("buddy", input, benchmark_filter, policy_filter);
+	RunPolicy<ForgeBackend<SizeClassAllocationPolicy<>>>("sizeclass", input, benchmark_filter, policy_filter);
+	RunPolicy<ForgeBackend<ThreadCacheAllocationPolicy<>>>("threadcache", input, benchmark_filter, policy_filter);
+	RunPolicy<ForgeBackend<ThreadArenaAllocationPolicy<>>>("threadarena", input, benchmark_filter, policy_filter);
+	RunPolicy<ForgeBackend<VirtualMemoryAllocationPolicy>>("virtualmemory", input, benchmark_filter, policy_filter);
+	RunPolicy<ForgeBackend<NumaAllocationPolicy>>("numa", input, benchmark_filter, policy_filter);
+
+	RunMemoryBenchmarks(benchmark_filter);
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,269 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+#include <unordered_map>
+
+#include <forge-memory/Allocator.hpp>
+#include <forge-memory/Trace.hpp>
+#include <forge-memory/VirtualMemory.hpp>
+
+#include <forge-memory/Policies/HeapAllocationPolicy.hpp>
+#include <forge-memory/Policies/LinearAllocationPolicy.hpp>
+#include <forge-memory/Policies/FreeListAllocationPolicy.hpp>
+#include <forge-memory/Policies/BuddyAllocationPolicy.hpp>
+#include <forge-memory/Policies/SizeClassAllocationPolicy.hpp>
+#include <forge-memory/Policies/ThreadCacheAllocationPolicy.hpp>
+#include <forge-memory/Policies/ThreadArenaAllocationPolicy.hpp>
+#include <forge-memory/Policies/VirtualMemoryAllocationPolicy.hpp>
+#include <forge-memory/Policies/NumaAllocationPolicy.hpp>
+
+using namespace Forge;
+
+namespace
+{
+	constexpr Size RSS_SAMPLE_INTERVAL = 4096;
+
+	struct LiveBlock
+	{
+		VoidPtr m_address;
+		Size    m_size;
+	};
+
+	struct ReplayResult
+	{
+		Float64 m_seconds;
+		Size    m_num_of_operations;
+		Size    m_num_of_failures;
+		Size    m_num_of_unknown_addresses;
+		Size    m_peak_requested_size;
+		Size    m_peak_allocated_size;
+		Size    m_peak_rss;
+	};
+
+	Size GetResidentSize()
+	{
+	#if defined(__linux__)
+		FILE* file = fopen("/proc/self/statm", "r");
+
+		if (!file) {
+			return 0;
+		}
+
+		unsigned long long num_of_pages = 0;
+		unsigned long long num_of_resident_pages = 0;
+
+		if (fscanf(file, "%llu %llu", &num_of_pages, &num_of_resident_pages) != 2) {
+			num_of_resident_pages = 0;
+		}
+
+		fclose(file);
+
+		return static_cast<Size>(num_of_resident_pages) * VirtualGetPageSize();
+	#else
+		return 0;
+	#endif
+	}
+
+	template<typename AllocationPolicy>
+	ReplayResult Replay(const ::std::vector<TraceRecord>& records, Size capacity)
+	{
+		Allocator<AllocationPolicy> allocator;
+		allocator.Initialize(capacity);
+
+		::std::unordered_map<Size, LiveBlock> live_blocks;
+		live_blocks.reserve(records.size() / 2 + 1);
+
+		ReplayResult result = {};
+
+		Size requested_size = 0;
+		Size base_rss = GetResidentSize();
+
+		auto start = ::std::chrono::steady_clock::now();
+
+		for (const TraceRecord& record : records) {
+			Size alignment = static_cast<Size>(1) << record.m_alignment_log2;
+
+			switch (record.m_operation) {
+			case TraceOperation::Allocate:
+			case TraceOperation::Callocate: {
+				VoidPtr address = record.m_operation == TraceOperation::Allocate ?
+					allocator.Allocate(record.m_size, alignment) :
+					allocator.Callocate(record.m_size, record.m_value, alignment);
+
+				if (!address) {
+					result.m_num_of_failures++;
+					break;
+				}
+
+				live_blocks[record.m_address] = { address, record.m_size };
+				requested_size += record.m_size;
+				break;
+			}
+			case TraceOperation::Reallocate: {
+				VoidPtr old_address = nullptr;
+				Size old_size = 0;
+
+				if (record.m_old_address) {
+					auto iterator = live_blocks.find(record.m_old_address);
+
+					if (iterator == live_blocks.end()) {
+						result.m_num_of_unknown_addresses++;
+						break;
+					}
+
+					old_address = iterator->second.m_address;
+					old_size = iterator->second.m_size;
+				}
+
+				VoidPtr address = allocator.Reallocate(old_address, record.m_size, alignment);
+
+				if (!address) {
+					result.m_num_of_failures++;
+					break;
+				}
+
+				live_blocks.erase(record.m_old_address);
+				live_blocks[record.m_address] = { address, record.m_size };
+				requested_size += record.m_size - old_size;
+				break;
+			}
+			case TraceOperation::Deallocate: {
+				auto iterator = live_blocks.find(record.m_address);
+
+				if (iterator == live_blocks.end()) {
+					result.m_num_of_unknown_addresses++;
+					break;
+				}
+
+				allocator.Deallocate(iterator->second.m_address);
+				requested_size -= iterator->second.m_size;
+				live_blocks.erase(iterator);
+				break;
+			}
+			case TraceOperation::Reset: {
+				allocator.Reset();
+				live_blocks.clear();
+				requested_size = 0;
+				break;
+			}
+			}
+
+			result.m_num_of_operations++;
+
+			if (result.m_peak_requested_size < requested_size) {
+				result.m_peak_requested_size = requested_size;
+			}
+
+			if (result.m_num_of_operations % RSS_SAMPLE_INTERVAL == 0) {
+				Size rss = GetResidentSize();
+
+				if (rss > base_rss && result.m_peak_rss < rss - base_rss) {
+					result.m_peak_rss = rss - base_rss;
+				}
+			}
+		}
+
+		result.m_seconds = ::std::chrono::duration<Float64>(::std::chrono::steady_clock::now() - start).count();
+		result.m_peak_allocated_size = allocator.GetPeakSize();
+
+		allocator.Deinitialize();
+
+		return result;
+	}
+
+	Void PrintResult(const char* policy, const ReplayResult& result)
+	{
+		printf("policy:              %s\n", policy);
+		printf("operations:          %zu\n", result.m_num_of_operations);
+		printf("failed operations:   %zu\n", result.m_num_of_failures);
+		printf("unknown addresses:   %zu\n", result.m_num_of_unknown_addresses);
+		printf("time:                %.3f s\n", result.m_seconds);
+		printf("throughput:          %.0f ops/s\n", result.m_seconds > 0 ? result.m_num_of_operations / result.m_seconds : 0.0);
+		printf("peak requested size: %zu bytes\n", result.m_peak_requested_size);
+		printf("peak allocated size: %zu bytes\n", result.m_peak_allocated_size);
+		printf("peak rss growth:     %zu bytes\n", result.m_peak_rss);
+
+		// Internal fragmentation is what size classes and headers round up, external is what the policy keeps resident beyond that.
+		if (result.m_peak_allocated_size) {
+			printf("internal fragmentation: %.2f %%\n", 100.0 * (1.0 - static_cast<Float64>(result.m_peak_requested_size) / result.m_peak_allocated_size));
+		}
+
+		if (result.m_peak_rss) {
+			printf("fragmentation:          %.2f %%\n", 100.0 * (1.0 - static_cast<Float64>(result.m_peak_requested_size) / result.m_peak_rss));
+		}
+	}
+
+	Void PrintUsage()
+	{
+		printf("usage: forge_memory_replay <trace file> <policy> [capacity in bytes]\n");
+		printf("policies: heap, linear, freelist, buddy, sizeclass, threadcache, threadarena, virtualmemory, numa\n");
+		printf("\n");
+		printf("Replays the trace on a single thread in timestamp order. Run one policy per process,\n");
+		printf("otherwise the resident size of an earlier replay skews the next one.\n");
+	}
+}
+
+int main(int argc, char** argv)
+{
+	if (argc < 3) {
+		PrintUsage();
+		return EXIT_FAILURE;
+	}
+
+	const char* path = argv[1];
+	const char* policy = argv[2];
+
+	Size capacity = argc > 3 ? static_cast<Size>(strtoull(argv[3], nullptr, 10)) : static_cast<Size>(1) << 30;
+
+	::std::vector<TraceRecord> records;
+
+	if (!ReadTrace(path, records)) {
+		fprintf(stderr, "failed to read trace file %s\n", path);
+		return EXIT_FAILURE;
+	}
+
+	// Every thread flushes its own ring buffer, so records of different threads are interleaved in the file.
+	::std::stable_sort(records.begin(), records.end(), [](const TraceRecord& left, const TraceRecord& right) {
+		return left.m_timestamp < right.m_timestamp;
+	});
+
+	ReplayResult result;
+
+	if (strcmp(policy, "heap") == 0) {
+		result = Replay<HeapAllocationPolicy>(records, capacity);
+	}
+	else if (strcmp(policy, "linear") == 0) {
+		result = Replay<LinearAllocationPolicy>(records, capacity);
+	}
+	else if (strcmp(policy, "freelist") == 0) {
+		result = Replay<FreeListAllocationPolicy>(records, capacity);
+	}
+	else if (strcmp(policy, "buddy") == 0) {
+		result = Replay<BuddyAllocationPolicy>(records, capacity);
+	}
+	else if (strcmp(policy, "sizeclass") == 0) {
+		result = Replay<SizeClassAllocationPolicy<>>(records, capacity);
+	}
+	else if (strcmp(policy, "threadcache") == 0) {
+		result = Replay<ThreadCacheAllocationPolicy<>>(records, capacity);
+	}
+	else if (strcmp(policy, "threadarena") == 0) {
+		result = Replay<ThreadArenaAllocationPolicy<>>(records, capacity);
+	}
+	else if (strcmp(policy, "virtualmemory") == 0) {
+		result = Replay<VirtualMemoryAllocationPolicy>(records, capacity);
+	}
+	else if (strcmp(policy, "numa") == 0) {
+		result = Replay<NumaAllocationPolicy>(records, capacity);
+	}
+	else {
+		PrintUsage();
+		return EXIT_FAILURE;
+	}
+
+	PrintResult(policy, result);
+
+	return EXIT_SUCCESS;
+}